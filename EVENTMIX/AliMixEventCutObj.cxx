@@ -27,7 +27,8 @@ AliMixEventCutObj::AliMixEventCutObj(AliMixEventCutObj::EEPAxis_t type, Float_t
    fCutMax(max),
    fCutStep(step),
    fCutSmallVal(0),
-   fCurrentVal(min)
+   fCurrentVal(min),
+   fBinEdges()
 {
    //
    // Default constructor
@@ -45,7 +46,8 @@ AliMixEventCutObj::AliMixEventCutObj(const AliMixEventCutObj &obj) : TObject(obj
    fCutMax(obj.fCutMax),
    fCutStep(obj.fCutStep),
    fCutSmallVal(obj.fCutSmallVal),
-   fCurrentVal(obj.fCurrentVal)
+   fCurrentVal(obj.fCurrentVal),
+   fBinEdges(obj.fBinEdges)
 {
    //
    // Copy constructor
@@ -69,6 +71,7 @@ AliMixEventCutObj &AliMixEventCutObj::operator=(const AliMixEventCutObj &obj)
       fCutStep = obj.fCutStep;
       fCutSmallVal = obj.fCutSmallVal;
       fCurrentVal = obj.fCurrentVal;
+      fBinEdges = obj.fBinEdges;
 //       fNoMore = obj.fNoMore;
    }
    return *this;
@@ -137,16 +140,37 @@ Int_t AliMixEventCutObj::GetBinNumber(Float_t num) const
    // Returns bin (index) number in current cut.
    // Returns -1 in case of out of range
    //
-   Int_t binNum = 0;
-   for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) {
-      binNum++;
-      if ((num >= iCurrent) && (num < iCurrent + fCutStep - fCutSmallVal)) {
-         return binNum;
-      }
-   }
+   // The bin is estimated from the step and corrected with the edges,
+   // which are accumulated as in the loop over the bins used before,
+   // so the result is the same without scanning all bins.
+   if (fBinEdges.GetSize() == 0) InitBinEdges();
+   Int_t nBins = fBinEdges.GetSize();
+   if (nBins == 0 || !(num >= fBinEdges[0])) return -1;
+   Float_t pos = (num - fCutMin) / fCutStep;
+   Int_t bin = (pos < nBins) ? (Int_t)pos : nBins - 1;
+   while (bin > 0 && num < fBinEdges[bin]) bin--;
+   while (bin + 1 < nBins && num >= fBinEdges[bin + 1]) bin++;
+   if (num < fBinEdges[bin] + fCutStep - fCutSmallVal) return bin + 1;
    return -1;
 }
 
+//_________________________________________________________________________________________________
+void AliMixEventCutObj::InitBinEdges() const
+{
+   //
+   // Fills lower edges of bins
+   //
+   Int_t nBins = 0;
+   if (fCutStep > 0) {
+      for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) nBins++;
+   }
+   fBinEdges.Set(nBins);
+   nBins = 0;
+   if (fCutStep > 0) {
+      for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) fBinEdges[nBins++] = iCurrent;
+   }
+}
+
 //_________________________________________________________________________________________________
 Int_t AliMixEventCutObj::GetIndex(AliVEvent *ev)
 {
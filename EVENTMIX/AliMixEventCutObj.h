@@ -13,6 +13,7 @@
 
 #include <TObject.h>
 #include <TString.h>
+#include <TArrayF.h>
 
 class AliVEvent;
 class AliAODEvent;
@@ -55,6 +56,8 @@ public:
    Bool_t      IsValid();
 
 private:
+   void        InitBinEdges() const;
+
    Int_t       fCutType;       // cut type
    TString     fCutOpt;        // cut option string
    Float_t     fCutMin;        // cut min
@@ -64,6 +67,8 @@ private:
 
    Float_t     fCurrentVal;    // current value
 
+   mutable TArrayF fBinEdges;  //! lower edges of the bins (filled on first use)
+
    ClassDef(AliMixEventCutObj, 3)
 };
 
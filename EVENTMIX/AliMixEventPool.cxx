@@ -23,7 +23,8 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fBinStrides()
 {
    //
    // Default constructor.
@@ -37,7 +38,8 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fBinStrides(obj.fBinStrides)
 {
    //
    // Copy constructor
@@ -59,6 +61,7 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fBinStrides = obj.fBinStrides;
    }
    return *this;
 }
@@ -111,10 +114,28 @@ Int_t AliMixEventPool::Init()
    fBinNumber++;
    AliDebug(AliLog::kDebug, Form("fBinnumber = %d", fBinNumber));
    AddEntryList();
+   InitBinStrides();
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
 }
 
+//_________________________________________________________________________________________________
+void AliMixEventPool::InitBinStrides()
+{
+   //
+   // Computes for every cut the distance between the entry lists of its
+   // neighbouring bins, the first cut changes fastest (as in CreateEntryListsRecursivly)
+   //
+   Int_t num = fListOfEventCuts.GetEntriesFast();
+   fBinStrides.Set(num);
+   Int_t stride = 1;
+   for (Int_t i = 0; i < num; i++) {
+      fBinStrides[i] = stride;
+      AliMixEventCutObj *cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
+      stride *= cut->GetNumberOfBins();
+   }
+}
+
 //_________________________________________________________________________________________________
 void AliMixEventPool::CreateEntryListsRecursivly(Int_t index)
 {
@@ -194,29 +215,23 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
    AliDebug(AliLog::kDebug + 5, "<-");
    Int_t num = fListOfEventCuts.GetEntriesFast();
    if (num < 1) return 0;
-   Int_t *indexes = new Int_t[num] ;
-   Int_t *lenght = new Int_t[num];
-   Int_t i = 0;
-   TObjArrayIter next(&fListOfEventCuts);
+   if (fBinStrides.GetSize() != num) InitBinStrides();
+   Int_t index = 0;
+   Int_t id = 0;
    AliMixEventCutObj *cut;
-   while ((cut = (AliMixEventCutObj *) next())) {
-      indexes[i] = cut->GetIndex(ev);
-      if (indexes[i] < 0) {
+   for (Int_t i = 0; i < num; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
+      index = cut->GetIndex(ev);
+      if (index < 0) {
          AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
-         delete [] indexes;
-         delete [] lenght;
          return 0;
       }
-      lenght[i] = cut->GetNumberOfBins();
-      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
-      i++;
+      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, index));
+      id += (index - 1) * fBinStrides[i];
    }
-   idEntryList = 0;
-   SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
+   // index which start with 1
+   idEntryList = id + 1;
    AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
-   // index which start with 0 (idEntryList-1)
-   delete [] indexes;
-   delete [] lenght;
    AliDebug(AliLog::kDebug + 5, "->");
    return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
 }
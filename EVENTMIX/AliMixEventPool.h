@@ -13,6 +13,7 @@
 
 #include <TObjArray.h>
 #include <TNamed.h>
+#include <TArrayI.h>
 
 class TEntryList;
 class AliMixEventCutObj;
@@ -51,6 +52,8 @@ public:
 
 private:
 
+   void        InitBinStrides();
+
    TObjArray   fListOfEntryList;       // list of entry lists
    TObjArray   fListOfEventCuts;       // list of entry lists
 
@@ -58,6 +61,8 @@ private:
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
 
+   TArrayI     fBinStrides;            //! distance between entry lists of neighbouring bins of each cut
+
    ClassDef(AliMixEventPool, 1)
 };
 
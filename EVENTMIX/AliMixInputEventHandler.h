@@ -52,6 +52,8 @@ public:
    void                    DoMixExtra(Bool_t b = kTRUE) { fDoMixExtra = b; }
    void                    DoMixIfNotEnoughEvents(Bool_t b = kTRUE) { fDoMixIfNotEnoughEvents = b; }
    void                    SetMixNumber(const Int_t mixNum);
+   void                    SetMaxOpenMixFiles(const Int_t num) { fMaxOpenMixFiles = num; }
+   Int_t                   MaxOpenMixFiles() const { return fMaxOpenMixFiles; }
 
    void                    SetCurrentBinIndex(Int_t const index) { fCurrentBinIndex = index; }
    void                    SetCurrentEntry(Long64_t const entry) { fCurrentEntry = entry ; }
@@ -89,6 +91,7 @@ private:
    Bool_t                  fDoMixExtra;            // mix extra events to get enough combinations
    Bool_t                  fDoMixIfNotEnoughEvents;// mix events if they don't have enough events to mix
    Bool_t                  fDoMixEventGetEntryAuto;// flag for preparing mixed events automatically (default on)
+   Int_t                   fMaxOpenMixFiles;       // number of mixed files kept open by every mixing handler
 
    // mixing info
    Long64_t fCurrentEntry;       //! current entry number (adds 1 for every event processed on each worker)
@@ -110,7 +113,7 @@ private:
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
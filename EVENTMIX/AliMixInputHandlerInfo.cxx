@@ -7,6 +7,9 @@
 // author:
 //        Martin Vala (martin.vala@cern.ch)
 //
+#include <algorithm>
+#include <cstring>
+
 #include <TTree.h>
 #include <TChain.h>
 #include <TFile.h>
@@ -23,8 +26,11 @@ ClassImp(AliMixInputHandlerInfo)
 AliMixInputHandlerInfo::AliMixInputHandlerInfo(const char *name, const char *title): TNamed(name, title),
    fChain(0),
    fChainEntriesArray(),
+   fChainEntriesSum(),
    fZeroEntryNumber(0),
-   fNeedNotify(kFALSE)
+   fNeedNotify(kFALSE),
+   fOpenChains(),
+   fMaxOpenChains(4)
 {
    //
    // Default constructor.
@@ -36,7 +42,8 @@ AliMixInputHandlerInfo::~AliMixInputHandlerInfo()
    //
    // Destructor
    //
-   if (fChain) delete fChain;
+   ReleaseChain();
+   fOpenChains.Delete();
 }
 
 //_____________________________________________________________________________
@@ -57,7 +64,7 @@ void AliMixInputHandlerInfo::AddChain(TChain *chain)
    //
    AliDebug(AliLog::kDebug + 5, "<-");
    if (!chain) return;
-   if (fChain) delete fChain;
+   ReleaseChain();
    fChain = new TChain(GetName());
    fChain->Add(chain);
    AliDebug(AliLog::kDebug + 5, "->");
@@ -81,6 +88,7 @@ void AliMixInputHandlerInfo::AddTreeToChain(const char *path)
    fChainEntriesArray.Set(lastIndex);
    AliDebug(AliLog::kDebug + 3, Form("Adding %lld to id %d", fChain->GetTree()->GetEntries(), lastIndex - 1));
    fChainEntriesArray.AddAt((Int_t)fChain->GetTree()->GetEntries(), (Int_t)lastIndex - 1);
+   fChainEntriesSum.Set(0);
    AliDebug(AliLog::kDebug + 5, Form("-> %s", path));
 }
 
@@ -98,17 +106,25 @@ TChainElement *AliMixInputHandlerInfo::GetEntryInTree(Long64_t &entry)
       AliDebug(AliLog::kDebug + 5, "->");
       return 0;
    }
-   Long64_t sumTree = fZeroEntryNumber;
-   for (Int_t i = 0; i < fChainEntriesArray.GetSize() ; i++) {
-      sumTree += fChainEntriesArray.At(i);
-      if (sumTree > entry) {
-         sumTree = entry - sumTree + fChainEntriesArray.At(i);
-         AliDebug(AliLog::kDebug + 1, Form("Entry in current tree num is %lld with i=%d", sumTree, i));
-         entry = sumTree;
-         AliDebug(AliLog::kDebug + 5, "->");
-         return (TChainElement *) fChain->GetListOfFiles()->At(i);
+   // cumulated entries are recomputed only when a tree was added
+   Int_t nTrees = fChainEntriesArray.GetSize();
+   if (fChainEntriesSum.GetSize() != nTrees) {
+      fChainEntriesSum.Set(nTrees);
+      Long64_t sumTree = 0;
+      for (Int_t i = 0; i < nTrees; i++) {
+         sumTree += fChainEntriesArray.At(i);
+         fChainEntriesSum[i] = sumTree;
       }
    }
+   // first tree with cumulated entries above entry
+   const Long64_t *sumBegin = fChainEntriesSum.GetArray();
+   Int_t i = std::upper_bound(sumBegin, sumBegin + nTrees, entry - fZeroEntryNumber) - sumBegin;
+   if (i < nTrees) {
+      entry -= fZeroEntryNumber + ((i > 0) ? sumBegin[i - 1] : 0);
+      AliDebug(AliLog::kDebug + 1, Form("Entry in current tree num is %lld with i=%d", entry, i));
+      AliDebug(AliLog::kDebug + 5, "->");
+      return (TChainElement *) fChain->GetListOfFiles()->At(i);
+   }
    entry = -1;
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
@@ -128,9 +144,8 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
    if (entry < 0) {
       AliDebug(AliLog::kDebug, Form("We are creating new chain from file %s ...", te->GetTitle()));
       if (!fChain) {
-         fChain = new TChain(te->GetName());
-         fChain->AddFile(te->GetTitle());
-         fChain->GetEntry(0);
+         fChain = OpenChain(te);
+         DisconnectChain(fChain);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
       }
@@ -144,11 +159,10 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
       if (fn.CompareTo(te->GetTitle())) {
          AliDebug(AliLog::kDebug, Form("Filename %s is NOT same ...", te->GetTitle()));
          AliDebug(AliLog::kDebug, Form("We are changing to file %s ...", te->GetTitle()));
-         // change file
-         delete fChain;
-         fChain = new TChain(te->GetName());
-         fChain->AddFile(te->GetTitle());
-         fChain->GetEntry(0);
+         // change file (kept open if it was used recently)
+         ReleaseChain();
+         fChain = OpenChain(te);
+         DisconnectChain(fChain);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
          eh->Notify(te->GetTitle());
@@ -171,6 +185,68 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
    AliDebug(AliLog::kDebug + 5, "->");
 }
 
+//_____________________________________________________________________________
+TChain *AliMixInputHandlerInfo::OpenChain(TChainElement *te)
+{
+   //
+   // Returns chain with file from te. The chains of the last fMaxOpenChains
+   // files stay open, so mixing with events from few files does not reopen
+   // them and their baskets are read again only when needed
+   //
+   TIter next(&fOpenChains);
+   TChain *chain;
+   while ((chain = (TChain *) next())) {
+      if (!strcmp(chain->GetTitle(), te->GetTitle())) {
+         AliDebug(AliLog::kDebug, Form("Reusing open chain of file %s ...", te->GetTitle()));
+         fOpenChains.Remove(chain);
+         fOpenChains.AddFirst(chain);
+         return chain;
+      }
+   }
+   chain = new TChain(te->GetName(), te->GetTitle());
+   chain->AddFile(te->GetTitle());
+   chain->GetEntry(0);
+   fOpenChains.AddFirst(chain);
+   while (fOpenChains.GetSize() > fMaxOpenChains) {
+      TObject *last = fOpenChains.Last();
+      fOpenChains.Remove(last);
+      delete last;
+   }
+   return chain;
+}
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::ReleaseChain()
+{
+   //
+   // Deletes current chain unless it is one of the open chains (those are
+   // deleted in OpenChain or in destructor)
+   //
+   if (fChain && !fOpenChains.FindObject(fChain)) delete fChain;
+   fChain = 0;
+}
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::DisconnectChain(TChain *chain)
+{
+   //
+   // Removes lists of event objects connected to tree of chain, so that input
+   // handler connects the tree again like a newly opened one. AliESDEvent and
+   // AliAODEvent::ReadFromTree would otherwise only take the list registered
+   // when the tree was connected before, without setting branch addresses
+   // again, while the event of the input handler was connected to other trees
+   // in the meantime. Objects are owned by the event in the user info of the
+   // tree, so they are not deleted
+   //
+   if (!chain || !chain->GetTree()) return;
+   TList *userInfo = chain->GetTree()->GetUserInfo();
+   const char *connectedLists[] = {"ESDObjectsConnectedToTree", "AODObjectsConnectedToTree"};
+   for (Int_t i = 0; i < 2; i++) {
+      TObject *connected;
+      while ((connected = userInfo->FindObject(connectedLists[i]))) userInfo->Remove(connected);
+   }
+}
+
 //_____________________________________________________________________________
 Long64_t AliMixInputHandlerInfo::GetEntries()
 {
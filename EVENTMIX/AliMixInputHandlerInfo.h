@@ -10,6 +10,8 @@
 #ifndef ALIMIXINPUTHANDLERINFO_H
 #define ALIMIXINPUTHANDLERINFO_H
 #include <TArrayI.h>
+#include <TArrayL64.h>
+#include <TList.h>
 #include <TNamed.h>
 
 class TTree;
@@ -30,19 +32,27 @@ public:
    void PrepareEntry(TChainElement *te, Long64_t entry, AliInputEventHandler *eh, Option_t *opt);
 
    void SetZeroEntryNumber(Long64_t num) { fZeroEntryNumber = num; }
+   void SetMaxOpenChains(Int_t num) { fMaxOpenChains = (num > 0) ? num : 1; }
    TChainElement *GetEntryInTree(Long64_t &entry);
    Long64_t      GetEntries();
 
 private:
+   TChain   *OpenChain(TChainElement *te);
+   void      ReleaseChain();
+   void      DisconnectChain(TChain *chain);
+
    TChain    *fChain;              // current chain
    TArrayI   fChainEntriesArray;   // array of entries of every chaing
+   TArrayL64 fChainEntriesSum;     //! cumulated entries up to every chain (for binary search)
    Long64_t  fZeroEntryNumber;     // zero entry number (will be used when we will delete not needed chains)
    Bool_t    fNeedNotify;          // flag if Notify is needed for current input handler
+   TList     fOpenChains;          //! chains of recently used mixed files, most recent first
+   Int_t     fMaxOpenChains;       // maximum number of chains kept open
 
    AliMixInputHandlerInfo(const AliMixInputHandlerInfo &handler);
    AliMixInputHandlerInfo &operator=(const AliMixInputHandlerInfo &handler);
 
-   ClassDef(AliMixInputHandlerInfo, 1); // Mix Input Handler info
+   ClassDef(AliMixInputHandlerInfo, 2); // Mix Input Handler info
 };
 
 #endif // ALIMIXINPUTHANDLERINFO_H
@@ -13,11 +13,26 @@
 #include "AliExternalBDT.h"
 
 #include <cassert>
+#include <cerrno>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace {
+  /// compiler and flags used for the model libraries, part of the cache key
+  const std::string kCompiler{"gcc"};
+  const std::string kCompilerFlags{"-O1 -fPIC"};
+
   inline bool checkFile (const std::string name) {
     FILE *file = fopen(name.c_str(), "r");
     if (file != NULL) {
@@ -27,6 +42,88 @@ namespace {
       return false;
     }
   }
+
+  /// 64 bit FNV-1a hash
+  inline unsigned long long hashBytes(const std::string &bytes, unsigned long long hash = 14695981039346656037ull) {
+    for (const char byte : bytes) {
+      hash ^= static_cast<unsigned char>(byte);
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  inline bool readFile(const std::string &name, std::string &content) {
+    std::ifstream file(name.data(), std::ios::in | std::ios::binary);
+    if (!file) return false;
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    content = buffer.str();
+    return true;
+  }
+
+  inline std::string commandOutput(const std::string &command) {
+    std::string output;
+    FILE *pipe = popen(command.data(), "r");
+    if (pipe == NULL) return output;
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), pipe) != NULL) output += buffer;
+    pclose(pipe);
+    return output;
+  }
+
+  /// the cache is only used if the directory, and the libraries in it, belong to the
+  /// current user and cannot be modified by anybody else
+  inline bool isPrivate(const std::string &path, bool directory) {
+    struct stat info;
+    if (stat(path.data(), &info) != 0) return false;
+    if (directory ? !S_ISDIR(info.st_mode) : !S_ISREG(info.st_mode)) return false;
+    return info.st_uid == getuid() && (info.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+  }
+
+  inline bool makeDirectory(const std::string &path) {
+    if (mkdir(path.data(), 0700) != 0 && errno != EEXIST) return false;
+    if (!isPrivate(path, true)) {
+      std::cerr << "Model cache " << path.data() << " is not a directory owned by the current user and closed to group and others, not using it" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /// single-quoted shell word, for paths coming from the environment
+  inline std::string shellQuote(const std::string &word) {
+    std::string quoted{"'"};
+    for (const char c : word) {
+      if (c == '\'') quoted += "'\\''";
+      else quoted += c;
+    }
+    return quoted + "'";
+  }
+
+  /// remove a build directory made with mkdtemp and the files treelite and the compiler wrote in it,
+  /// without going through the shell
+  inline bool removeBuildDirectory(const std::string &path) {
+    DIR *dir = opendir(path.data());
+    if (dir == NULL) return false;
+    bool removed = true;
+    while (struct dirent *entry = readdir(dir)) {
+      const std::string name{entry->d_name};
+      if (name == "." || name == "..") continue;
+      if (unlink((path + "/" + name).data()) != 0) removed = false;
+    }
+    closedir(dir);
+    return rmdir(path.data()) == 0 && removed;
+  }
+
+  /// content hash of the shared library providing the given treelite function: identifies the
+  /// treelite version (code generator and runtime) the cached libraries were made with
+  inline std::string libraryHash(void *function) {
+    Dl_info info;
+    std::string content;
+    if (dladdr(function, &info) == 0 || info.dli_fname == NULL || !readFile(info.dli_fname, content)) return "unknown";
+    std::ostringstream hash;
+    hash << std::hex << hashBytes(content);
+    return hash.str();
+  }
 }
 
 AliExternalBDT::AliExternalBDT(std::string name) :
@@ -35,7 +132,10 @@ AliExternalBDT::AliExternalBDT(std::string name) :
   fModelPath{""},
   fModelName{""},
   fCompiler{},
-  fPredictor{}
+  fPredictor{},
+  fEntries{},
+  fBatchFeatures{},
+  fBatchScores{}
 {
 }
 
@@ -46,32 +146,105 @@ bool AliExternalBDT::CompileAndLoadModelLibrary() {
     std::cout << "Library found: " << path.data() << "/main.so . Loading it!" << std::endl;
   } else {
     std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
-    system((std::string("gcc -c -O1 -fPIC ") + path + "/main.c -o " + path + "/main.o && gcc -shared " + path + \
-          "/main.o -o " + path + "/main.so").data());
+    CompileModelCode(path);
   }
   return LoadModelLibrary(path + "/main.so");
 }
 
+bool AliExternalBDT::CompileModelCode(const std::string &path) {
+  return system((kCompiler + " -c " + kCompilerFlags + " " + shellQuote(path + "/main.c") + " -o " + shellQuote(path + "/main.o") + " && " + kCompiler + \
+          " -shared " + shellQuote(path + "/main.o") + " -o " + shellQuote(path + "/main.so")).data()) == 0;
+}
+
 bool AliExternalBDT::CreateModelCode() {
   std::string path = GetUniquePath();
   if (checkFile(path + "/main.c")) {
     std::cout << "Code found: " << path.data() << "/main.c . \
       Remove it or unset/change the AliExternalBDT name to force its regeneration." << std::endl;
   } else {
-    const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
-    if (status_comp != 0) {
-      std::cerr << "Compiler creation failed." << std::endl;
-      return false;
-    }
-    const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, path.data());
-    if (status_gen != 0) {
-      std::cerr << "Code generation failed." << std::endl;
-      return false;
-    }
+    return GenerateModelCode(path);
+  }
+  return true;
+}
+
+bool AliExternalBDT::GenerateModelCode(const std::string &path) {
+  if (fCompiler != NULL) {
+    TreeliteCompilerFree(fCompiler);
+    fCompiler = NULL;
+  }
+  const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
+  if (status_comp != 0) {
+    std::cerr << "Compiler creation failed." << std::endl;
+    return false;
+  }
+  const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, path.data());
+  if (status_gen != 0) {
+    std::cerr << "Code generation failed." << std::endl;
+    return false;
   }
   return true;
 }
 
+std::string AliExternalBDT::GetCacheDirectory() {
+  const char *cache = getenv("ALIEXTERNALBDT_CACHE");
+  if (cache != NULL) return cache;
+  const char *tmp = getenv("TMPDIR");
+  return std::string(tmp != NULL && tmp[0] != '\0' ? tmp : "/tmp") + "/AliExternalBDT_cache_" + std::to_string(getuid());
+}
+
+bool AliExternalBDT::GetCacheKey(int type, std::string &key) {
+  std::string model;
+  if (!readFile(fModelPath, model)) return false;
+  /// everything that changes the generated library: model, model type, code generator (and its
+  /// treelite version), treelite runtime, compiler and flags
+  static const std::string treeliteVersion = libraryHash(reinterpret_cast<void *>(&TreeliteCompilerGenerateCode)) + "|" +
+                                             libraryHash(reinterpret_cast<void *>(&TreelitePredictorLoad));
+  std::ostringstream description;
+  description << type << "|ast_native|" << treeliteVersion << "|" << kCompiler << "|" << commandOutput(kCompiler + " -dumpfullversion -dumpversion")
+              << "|" << kCompilerFlags << "|";
+  std::ostringstream hash;
+  hash << std::hex << std::setw(16) << std::setfill('0') << hashBytes(model, hashBytes(description.str()));
+  key = fModelName + "_" + hash.str();
+  return true;
+}
+
+bool AliExternalBDT::LoadCachedModelLibrary(const std::string &cacheDir, int type) {
+  std::string key;
+  if (!makeDirectory(cacheDir) || !GetCacheKey(type, key)) return false;
+  const std::string library = cacheDir + "/" + key + ".so";
+  if (isPrivate(library, false)) {
+    std::cout << "Cached library found: " << library.data() << " . Loading it!" << std::endl;
+    return LoadModelLibrary(library);
+  }
+
+  /// only one process per cache entry compiles, the others wait and load its library
+  const int lock = open((cacheDir + "/" + key + ".lock").data(), O_CREAT | O_RDWR, 0600);
+  if (lock < 0) return false;
+  bool built = flock(lock, LOCK_EX) == 0;
+  if (built && !isPrivate(library, false)) {
+    built = false;
+    std::string buildDir = cacheDir + "/" + key + "_XXXXXX";
+    if (mkdtemp(&buildDir[0]) != NULL) {
+      std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
+      /// the library is made private whatever the umask, and published with an atomic rename,
+      /// so it is never seen half written
+      built = LoadTreeliteModel(type) && GenerateModelCode(buildDir) && CompileModelCode(buildDir) &&
+              chmod((buildDir + "/main.so").data(), 0600) == 0 &&
+              rename((buildDir + "/main.so").data(), library.data()) == 0;
+      if (!removeBuildDirectory(buildDir)) {
+        std::cerr << "Could not remove the build directory " << buildDir.data() << std::endl;
+      }
+    }
+  }
+  flock(lock, LOCK_UN);
+  close(lock);
+  if (!built || !isPrivate(library, false)) {
+    std::cerr << "Model compilation in the cache " << cacheDir.data() << " failed." << std::endl;
+    return false;
+  }
+  return LoadModelLibrary(library);
+}
+
 std::string AliExternalBDT::GetUniquePath() {
   if (fBDTname.empty()) {
     return fModelName + std::to_string((unsigned long)this);
@@ -87,6 +260,23 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
   }
   fModelPath = path;
   fModelName = fModelPath.substr(fModelPath.find_last_of("\\/")+1,fModelPath.size());
+  const std::string cacheDir = GetCacheDirectory();
+  if (!cacheDir.empty()) {
+    if (LoadCachedModelLibrary(cacheDir, type)) return true;
+    std::cout << "Model cache " << cacheDir.data() << " not usable, compiling the model in the working directory" << std::endl;
+  }
+  if (!LoadTreeliteModel(type)) return false;
+  if (!CreateModelCode()) return false;
+  if (!CompileAndLoadModelLibrary()) return false;
+  return true;
+}
+
+bool AliExternalBDT::LoadTreeliteModel(int type) {
+  /// a model already loaded (e.g. by a failed attempt with the cache) is released first
+  if (fModel != NULL) {
+    TreeliteFreeModel(fModel);
+    fModel = NULL;
+  }
   int status = 0;
   switch (type) {
     case 0:
@@ -103,8 +293,6 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
     std::cerr << "Model loading failed" << std::endl;
     return false;
   }
-  if (!CreateModelCode()) return false;
-  if (!CompileAndLoadModelLibrary()) return false;
   return true;
 }
 
@@ -127,17 +315,51 @@ bool AliExternalBDT::LoadModelLibrary(std::string path) {
   return true;
 }
 
-double AliExternalBDT::Predict(double *features, int size, bool useRawScore) {
-  std::vector<TreelitePredictorEntry> entries(size);
-  for (size_t iEntry = 0; iEntry < entries.size(); ++iEntry) {
-    entries[iEntry].fvalue = static_cast<float>(features[iEntry]);
+double AliExternalBDT::Predict(const double *features, int size, bool useRawScore) {
+  fEntries.resize(size);
+  for (size_t iEntry = 0; iEntry < fEntries.size(); ++iEntry) {
+    fEntries[iEntry].fvalue = static_cast<float>(features[iEntry]);
   }
   size_t out_size{0u};
   TreelitePredictorQueryResultSizeSingleInst(fPredictor, &out_size);
   assert(out_size == 1);
   float output = 0.f;
-  TreelitePredictorPredictInst(fPredictor, entries.data(),
+  TreelitePredictorPredictInst(fPredictor, fEntries.data(),
       static_cast<int>(useRawScore), &output,
       &out_size);
   return output;
 }
+
+bool AliExternalBDT::PredictBatch(const double *features, int nRows, int nCols, double *scores, bool useRawScore) {
+  if (nRows <= 0) return true;
+  const size_t size = static_cast<size_t>(nRows) * nCols;
+  fBatchFeatures.resize(size);
+  for (size_t iEntry = 0; iEntry < size; ++iEntry) {
+    fBatchFeatures[iEntry] = static_cast<float>(features[iEntry]);
+  }
+  /// NaN marks missing values: the candidate features are never NaN, so as in Predict all values are used
+  DenseBatchHandle batch;
+  if (TreeliteAssembleDenseBatch(fBatchFeatures.data(), std::numeric_limits<float>::quiet_NaN(), nRows, nCols, &batch) != 0) {
+    std::cerr << "Batch creation failed" << std::endl;
+    return false;
+  }
+  /// one score per candidate: models with several outputs per candidate (multi-class) are not supported
+  size_t out_size{0u};
+  if (TreelitePredictorQueryResultSize(fPredictor, batch, 0, &out_size) != 0 || out_size != static_cast<size_t>(nRows)) {
+    std::cerr << "Batch prediction not supported: " << out_size << " outputs for " << nRows << " candidates" << std::endl;
+    TreeliteDeleteDenseBatch(batch);
+    return false;
+  }
+  fBatchScores.resize(out_size);
+  const int status = TreelitePredictorPredictBatch(fPredictor, batch, 0, 0, static_cast<int>(useRawScore),
+      fBatchScores.data(), &out_size);
+  TreeliteDeleteDenseBatch(batch);
+  if (status != 0 || out_size != static_cast<size_t>(nRows)) {
+    std::cerr << "Batch prediction failed" << std::endl;
+    return false;
+  }
+  for (int iRow = 0; iRow < nRows; ++iRow) {
+    scores[iRow] = fBatchScores[iRow];
+  }
+  return true;
+}
@@ -29,13 +29,27 @@ public:
   bool LoadModelLibrary(std::string path);
   bool LoadXGBoostModel(std::string path);
 
-  double Predict(double *features, int size, bool useRaw = false);
+  double Predict(const double *features, int size, bool useRaw = false);
+  /// score nRows candidates stored row-major in features (nRows x nCols), the
+  /// scores are written to scores, which must hold nRows values
+  bool PredictBatch(const double *features, int nRows, int nCols, double *scores, bool useRaw = false);
+
+  /// Compiled models are kept in a cache directory shared by the jobs of a user on a node, keyed by the
+  /// hash of the model file, the treelite libraries, the compiler and its flags: identical models are compiled once.
+  /// The directory is $ALIEXTERNALBDT_CACHE (empty to disable the cache), $TMPDIR/AliExternalBDT_cache_<uid> by default.
+  /// It is created with mode 0700; a directory or library not owned by the user, or writable by group or others, is not used.
+  static std::string GetCacheDirectory();
 
 private:
   bool CompileAndLoadModelLibrary();
+  bool CompileModelCode(const std::string &path);
   bool CreateModelCode();
+  bool GenerateModelCode(const std::string &path);
+  bool GetCacheKey(int type, std::string &key);
   std::string GetUniquePath();
+  bool LoadCachedModelLibrary(const std::string &cacheDir, int type);
   bool LoadModel(const std::string &path, int type);
+  bool LoadTreeliteModel(int type);
 
   std::string fBDTname;       /// Unique name of this external BDT handler
   ModelHandle fModel;
@@ -43,6 +57,10 @@ private:
   std::string fModelName;
   CompilerHandle fCompiler;
   PredictorHandle fPredictor;
+
+  std::vector<TreelitePredictorEntry> fEntries; /// features of a single candidate, reused between calls
+  std::vector<float> fBatchFeatures;             /// features of a batch in single precision, reused between calls
+  std::vector<float> fBatchScores;               /// scores of a batch, reused between calls
 };
 
 #endif
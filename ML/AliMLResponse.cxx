@@ -12,6 +12,8 @@
 
 #include "AliMLResponse.h"
 
+#include <algorithm>
+
 #include "yaml-cpp/yaml.h"
 
 #include "AliExternalBDT.h"
@@ -29,7 +31,8 @@ ClassImp(AliMLResponse);
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse()
     : TNamed(), fConfigFilePath{}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{}, fNVariables{},
-      fBinsBegin{}, fRaw{} {
+      fBinsBegin{}, fNBatchColumns{}, fBatchColumnIndex{}, fBatchBin{}, fBatchBinCandidates{}, fBatchBinOffset{},
+      fBatchFeatures{}, fBatchScores{}, fRaw{} {
   //
   // Default constructor
   //
@@ -38,7 +41,8 @@ AliMLResponse::AliMLResponse()
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse(const Char_t *name, const Char_t *title)
     : TNamed(name, title), fConfigFilePath{""}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{},
-      fNVariables{}, fBinsBegin{}, fRaw{} {
+      fNVariables{}, fBinsBegin{}, fNBatchColumns{}, fBatchColumnIndex{}, fBatchBin{}, fBatchBinCandidates{},
+      fBatchBinOffset{}, fBatchFeatures{}, fBatchScores{}, fRaw{} {
   //
   // Standard constructor
   //
@@ -55,7 +59,9 @@ AliMLResponse::~AliMLResponse() {
 AliMLResponse::AliMLResponse(const AliMLResponse &source)
     : TNamed(source.GetName(), source.GetTitle()), fConfigFilePath{source.fConfigFilePath}, fModels{source.fModels},
       fCentClasses{source.fCentClasses}, fBins{source.fBins}, fVariableNames{source.fVariableNames},
-      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin}, fRaw{source.fRaw} {
+      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin},
+      fNBatchColumns{source.fNBatchColumns}, fBatchColumnIndex{source.fBatchColumnIndex}, fBatchBin{},
+      fBatchBinCandidates{}, fBatchBinOffset{}, fBatchFeatures{}, fBatchScores{}, fRaw{source.fRaw} {
   //
   // Copy constructor
   //
@@ -77,6 +83,8 @@ AliMLResponse &AliMLResponse::operator=(const AliMLResponse &source) {
   fNBins          = source.fNBins;
   fNVariables     = source.fNVariables;
   fBinsBegin      = source.fBinsBegin;
+  fNBatchColumns    = source.fNBatchColumns;
+  fBatchColumnIndex = source.fBatchColumnIndex;
   fRaw            = source.fRaw;
 
   return *this;
@@ -147,17 +155,18 @@ int AliMLResponse::FindBin(double binvar) {
 }
 
 //_______________________________________________________________________________
-double AliMLResponse::Predict(double binvar, map<string, double> varmap) {
+double AliMLResponse::Predict(double binvar, const map<string, double> &varmap) {
   if ((int)varmap.size() < fNVariables) {
     AliFatal("The variable map you provided to the predictor has a size smaller than the variable list size! Exit");
   }
 
-  vector<double> features;
-  for (const auto &varname : fVariableNames) {
-    if (varmap.find(varname) == varmap.end()) {
-      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", varname.data()));
+  fBatchFeatures.resize(fNVariables);
+  for (int iVar = 0; iVar < fNVariables; ++iVar) {
+    const auto var = varmap.find(fVariableNames[iVar]);
+    if (var == varmap.end()) {
+      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", fVariableNames[iVar].data()));
     }
-    features.push_back(varmap[varname]);
+    fBatchFeatures[iVar] = var->second;
   }
 
   int bin = FindBin(binvar);
@@ -166,11 +175,11 @@ double AliMLResponse::Predict(double binvar, map<string, double> varmap) {
     return -999.;
   }
 
-  return fModels[bin - 1].GetModel()->Predict(&features[0], fNVariables, fRaw);
+  return fModels[bin - 1].GetModel()->Predict(fBatchFeatures.data(), fNVariables, fRaw);
 }
 
 //_______________________________________________________________________________
-double AliMLResponse::Predict(double binvar, vector<double> variables) {
+double AliMLResponse::Predict(double binvar, const vector<double> &variables) {
   if ((int)variables.size() != fNVariables) {
     AliFatal(Form("Number of variables passed (%d) different from the one used in the model (%d)! Exit",
                   (int)variables.size(), fNVariables));
@@ -186,13 +195,80 @@ double AliMLResponse::Predict(double binvar, vector<double> variables) {
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelected(double binvar, std::map<std::string, double> varmap) {
+bool AliMLResponse::IsSelected(double binvar, const std::map<std::string, double> &varmap) {
   double score{0.};
   return IsSelected(binvar, varmap, score);
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelected(double binvar, std::vector<double> variables) {
+bool AliMLResponse::IsSelected(double binvar, const std::vector<double> &variables) {
   double score{0.};
   return IsSelected(binvar, variables, score);
+}
+
+//_______________________________________________________________________________
+void AliMLResponse::SetBatchColumns(const std::vector<std::string> &columns) {
+  fNBatchColumns = columns.size();
+  fBatchColumnIndex.resize(fNVariables);
+  for (int iVar = 0; iVar < fNVariables; ++iVar) {
+    const auto column = std::find(columns.begin(), columns.end(), fVariableNames[iVar]);
+    if (column == columns.end()) {
+      AliFatal(Form("Variable |%s| not found in the batch columns! Exit", fVariableNames[iVar].data()));
+    }
+    fBatchColumnIndex[iVar] = column - columns.begin();
+  }
+}
+
+//_______________________________________________________________________________
+void AliMLResponse::PredictBatch(int nCandidates, const double *binvars, const double *rows, double *scores) {
+  if ((int)fBatchColumnIndex.size() != fNVariables) {
+    AliFatal("Batch columns not set, call SetBatchColumns first! Exit");
+  }
+
+  /// group the candidates by bin (counting sort), so that each model is called once;
+  /// candidates without a model (same check as in Predict) are collected in bin 0
+  fBatchBin.resize(nCandidates);
+  fBatchBinOffset.assign(fNBins + 1, 0);
+  for (int iCand = 0; iCand < nCandidates; ++iCand) {
+    int bin = FindBin(binvars[iCand]);
+    if (bin < 1 || bin >= fNBins) bin = 0;
+    fBatchBin[iCand] = bin;
+    fBatchBinOffset[bin + 1]++;
+  }
+  for (int iBin = 0; iBin < fNBins; ++iBin) {
+    fBatchBinOffset[iBin + 1] += fBatchBinOffset[iBin];
+  }
+  fBatchBinCandidates.resize(nCandidates);
+  for (int iCand = 0; iCand < nCandidates; ++iCand) {
+    fBatchBinCandidates[fBatchBinOffset[fBatchBin[iCand]]++] = iCand;
+  }
+  /// fBatchBinOffset[iBin] now points to the end of bin iBin, i.e. the start of bin iBin+1
+  int first = 0;
+  for (int iBin = 0; iBin < fNBins; ++iBin) {
+    const int last = fBatchBinOffset[iBin];
+    const int nBinCandidates = last - first;
+    if (nBinCandidates == 0) continue;
+
+    if (iBin == 0) {
+      AliWarning("Binned variable outside range, no model available!");
+      for (int iEntry = first; iEntry < last; ++iEntry) scores[fBatchBinCandidates[iEntry]] = -999.;
+      first = last;
+      continue;
+    }
+
+    /// gather the model variables of the candidates of this bin
+    fBatchFeatures.resize(nBinCandidates * fNVariables);
+    for (int iEntry = first; iEntry < last; ++iEntry) {
+      const double *row = rows + (size_t)fBatchBinCandidates[iEntry] * fNBatchColumns;
+      double *features = &fBatchFeatures[(size_t)(iEntry - first) * fNVariables];
+      for (int iVar = 0; iVar < fNVariables; ++iVar) features[iVar] = row[fBatchColumnIndex[iVar]];
+    }
+    fBatchScores.resize(nBinCandidates);
+    if (!fModels[iBin - 1].GetModel()->PredictBatch(fBatchFeatures.data(), nBinCandidates, fNVariables,
+                                                    fBatchScores.data(), fRaw)) {
+      AliFatal("Error in batch prediction! Exit");
+    }
+    for (int iEntry = first; iEntry < last; ++iEntry) scores[fBatchBinCandidates[iEntry]] = fBatchScores[iEntry - first];
+    first = last;
+  }
 }
\ No newline at end of file
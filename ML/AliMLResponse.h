@@ -49,17 +49,26 @@ public:
   /// return the bin index
   int FindBin(double binvar);
   /// return the ML model predicted score (raw or proba, depending on useraw)
-  double Predict(double binvar, std::map<std::string, double> varmap);
+  double Predict(double binvar, const std::map<std::string, double> &varmap);
   /// overload to pass directly a vector of variables
-  double Predict(double binvar, std::vector<double> variables);
+  double Predict(double binvar, const std::vector<double> &variables);
   /// return true if predicted score for map is above the threshold given in the config
-  bool IsSelected(double binvar, std::map<std::string, double> varmap);
+  bool IsSelected(double binvar, const std::map<std::string, double> &varmap);
   /// overload for getting the model score too
-  template <typename F> bool IsSelected(double binvar, std::map<std::string, double> varmap, F &score);
+  template <typename F> bool IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score);
   /// overload to pass directly a vector of variables
-  bool IsSelected(double binvar, std::vector<double> variables);
+  bool IsSelected(double binvar, const std::vector<double> &variables);
   /// overload for getting the model score too
-  template <typename F> bool IsSelected(double binvar, std::vector<double> variables, F &score);
+  template <typename F> bool IsSelected(double binvar, const std::vector<double> &variables, F &score);
+
+  /// set the column layout of the rows passed to PredictBatch: the model variables are
+  /// looked up once in columns, which may contain additional variables not used by the models
+  void SetBatchColumns(const std::vector<std::string> &columns);
+  /// score nCandidates rows (row-major, one row of GetNBatchColumns() values per candidate)
+  /// with the model of the bin of binvars[i]; scores of candidates outside the bins are set to -999
+  void PredictBatch(int nCandidates, const double *binvars, const double *rows, double *scores);
+  /// number of columns of the rows passed to PredictBatch
+  int GetNBatchColumns() const { return fNBatchColumns; }
 
 protected:
   std::string fConfigFilePath;    /// path of the config file
@@ -74,6 +83,14 @@ protected:
 
   std::vector<float>::iterator fBinsBegin;    //!<!  evaluate just once is better
 
+  int fNBatchColumns;                         //!<! number of columns of the rows passed to PredictBatch
+  std::vector<int> fBatchColumnIndex;         //!<! column of each model variable in the rows passed to PredictBatch
+  std::vector<int> fBatchBin;                 //!<! bin of each candidate of the current batch
+  std::vector<int> fBatchBinCandidates;       //!<! candidates of the current batch sorted by bin
+  std::vector<int> fBatchBinOffset;           //!<! first entry of each bin in fBatchBinCandidates
+  std::vector<double> fBatchFeatures;         //!<! features of the candidates of one bin
+  std::vector<double> fBatchScores;           //!<! scores of the candidates of one bin
+
   bool fRaw;    /// set to true to use raw score instead of probability
 
   /// \cond CLASSIMP
@@ -81,13 +98,13 @@ protected:
   /// \endcond
 };
 
-template <typename F> bool AliMLResponse::IsSelected(double binvar, std::map<std::string, double> varmap, F &score) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score) {
   int bin = FindBin(binvar);
   score   = Predict(binvar, varmap);
   return score >= fModels[bin - 1].GetScoreCut();
 }
 
-template <typename F> bool AliMLResponse::IsSelected(double binvar, std::vector<double> variables, F &score) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const std::vector<double> &variables, F &score) {
   int bin = FindBin(binvar);
   score   = Predict(binvar, variables);
   return score >= fModels[bin - 1].GetScoreCut();
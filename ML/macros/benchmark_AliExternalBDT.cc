@@ -0,0 +1,111 @@
+#include <TFile.h>
+#include <TStopwatch.h>
+#include <TTree.h>
+#include <TTreeReader.h>
+#include <TTreeReaderValue.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AliExternalBDT.h"
+
+#define DELTA 1.0e-6
+
+/// compare the candidate-by-candidate prediction with the batch prediction
+/// (same scores, time per candidate) on the test sample of test_AliEsternalBDT.cc
+int benchmark_AliExternalBDT(string path = "", int batchSize = 1000, int nRepetitions = 10) {
+
+  string tree_path, model_path;
+
+  if (path == "") {
+    tree_path  = "test_tree_pt8_12.root";
+    model_path = "test_xgboost_pt8_12.model";
+  } else {
+    tree_path  = path + "/" + "test_tree_pt8_12.root";
+    model_path = path + "/" + "test_xgboost_pt8_12.model";
+  }
+
+  const int nFeatures = 12;
+  std::vector<double> features;
+
+  TFile *fInput = new TFile(tree_path.data(), "READ");
+
+  TTreeReader fReader("tree_real_data", fInput);
+
+  TTreeReaderValue<float> fValueDeltaMass(fReader, "delta_mass_KK");
+  TTreeReaderValue<float> fValueDLen(fReader, "d_len");
+  TTreeReaderValue<float> fValueNormDLXY(fReader, "norm_dl_xy");
+  TTreeReaderValue<float> fValueSigVert(fReader, "sig_vert");
+  TTreeReaderValue<float> fValueCosPiKPhi(fReader, "cos_PiKPhi_3");
+  TTreeReaderValue<float> fValueNormIP(fReader, "norm_IP");
+  TTreeReaderValue<float> fValueSigCombK0(fReader, "sigComb_K_0");
+  TTreeReaderValue<float> fValueSigCombK1(fReader, "sigComb_K_1");
+  TTreeReaderValue<float> fValueSigCombK2(fReader, "sigComb_K_2");
+  TTreeReaderValue<float> fValueSigCombPi0(fReader, "sigComb_Pi_0");
+  TTreeReaderValue<float> fValueSigCombPi1(fReader, "sigComb_Pi_1");
+  TTreeReaderValue<float> fValueSigCombPi2(fReader, "sigComb_Pi_2");
+
+  while (fReader.Next()) {
+    double candidate[nFeatures] = {*fValueDeltaMass,  *fValueDLen,       *fValueNormDLXY,
+                                   *fValueSigVert,    *fValueCosPiKPhi,  *fValueNormIP,
+                                   *fValueSigCombK0,  *fValueSigCombK1,  *fValueSigCombK2,
+                                   *fValueSigCombPi0, *fValueSigCombPi1, *fValueSigCombPi2};
+    features.insert(features.end(), candidate, candidate + nFeatures);
+  }
+  fInput->Close();
+
+  const int nCandidates = features.size() / nFeatures;
+  if (nCandidates == 0 || batchSize <= 0) {
+    std::cout << "BENCHMARK: no candidates!" << std::endl;
+    return 1;
+  }
+
+  AliExternalBDT *fBDT = new AliExternalBDT();
+
+  if (!fBDT->LoadXGBoostModel(model_path.data())) {
+    return 1;
+  }
+
+  std::vector<double> singleScores(nCandidates), batchScores(nCandidates);
+
+  TStopwatch singleWatch;
+  for (int iRep = 0; iRep < nRepetitions; ++iRep) {
+    for (int iCand = 0; iCand < nCandidates; ++iCand) {
+      singleScores[iCand] = fBDT->Predict(&features[iCand * nFeatures], nFeatures, true);
+    }
+  }
+  singleWatch.Stop();
+
+  TStopwatch batchWatch;
+  for (int iRep = 0; iRep < nRepetitions; ++iRep) {
+    for (int iCand = 0; iCand < nCandidates; iCand += batchSize) {
+      const int nRows = std::min(batchSize, nCandidates - iCand);
+      if (!fBDT->PredictBatch(&features[iCand * nFeatures], nRows, nFeatures, &batchScores[iCand], true)) {
+        delete fBDT;
+        return 1;
+      }
+    }
+  }
+  batchWatch.Stop();
+  delete fBDT;
+
+  const double nPredictions = 1.e-6 * nCandidates * nRepetitions;
+  std::cout << "Candidates: " << nCandidates << ", repetitions: " << nRepetitions << ", batch size: " << batchSize
+            << std::endl;
+  std::cout << "Predict:      " << singleWatch.RealTime() / nPredictions << " s per million candidates" << std::endl;
+  std::cout << "PredictBatch: " << batchWatch.RealTime() / nPredictions << " s per million candidates" << std::endl;
+
+  for (int iCand = 0; iCand < nCandidates; ++iCand) {
+    if (std::abs(singleScores[iCand] - batchScores[iCand]) > DELTA) {
+      std::cout << "BENCHMARK: Fail! Candidate " << iCand << ": " << singleScores[iCand] << " != " << batchScores[iCand]
+                << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "BENCHMARK: Success!" << std::endl;
+  return 0;
+}
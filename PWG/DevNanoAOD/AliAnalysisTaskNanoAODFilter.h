@@ -49,6 +49,7 @@ public:
   void  AddPIDField(AliNanoAODTrack::ENanoPIDResponse response, AliPID::EParticleType particle);
   void  SetVarListHeader(TString var                    ) { fReplicator->SetVarListHeader(var);}
   void  SetVarFiredTriggerClasses (TString var          ) { fReplicator->SetVarListHeaderTC(var);}
+  void  SetColumnarTracks(Bool_t var = kTRUE)            { fReplicator->SetColumnarTracks(var); }
   void  SaveVzero(Bool_t var)                             { fReplicator->SetSaveVzero(var); }
   void  SaveZDC(Bool_t var)                               { fReplicator->SetSaveZDC(var); }
   void  SaveV0s(Bool_t var, AliAnalysisCuts* v0Cuts = 0)  { fReplicator->SetSaveV0s(var); fReplicator->SetV0Cuts(v0Cuts); if (fSaveCutsFlag && v0Cuts) fQAOutput->Add(v0Cuts); }
@@ -49,6 +49,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -85,6 +86,7 @@ AliAODBranchReplicator(),
   fConversionPhotonCuts(0),
   fMCParticleCuts(nullptr),
   fTracks(0x0), 
+  fTrackColumns(0x0),
   fHeader(0x0), 
   fVertices(0x0), 
   fList(0x0),
@@ -111,6 +113,7 @@ AliAODBranchReplicator(),
   fDeltaAODBranchName(""),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
+  fColumnarTracks(kFALSE),
   fKeepDaughters(),
   fClonedVertices()
   {
@@ -125,6 +128,7 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fConversionPhotonCuts(0),
   fMCParticleCuts(nullptr),
   fTracks(0x0), 
+  fTrackColumns(0x0),
   fHeader(0x0), 
   fVertices(0x0), 
   fList(0x0),
@@ -151,6 +155,7 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fDeltaAODBranchName(""),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
+  fColumnarTracks(kFALSE),
   fKeepDaughters(),
   fClonedVertices()
 {
@@ -319,10 +324,18 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
     }
 
     // loop on (kept) tracks to find their ancestors
-    TIter nextTRACK(fTracks);
-    AliNanoAODTrack* track;
-    while ((track = static_cast<AliNanoAODTrack*>(nextTRACK()))) {
-      Int_t label = TMath::Abs(track->GetLabel());
+    std::vector<Int_t> trackLabels;
+    if (fTrackColumns) {
+      for (Int_t iTrack = 0; iTrack < fTrackColumns->GetNumberOfTracks(); iTrack++)
+        trackLabels.push_back(fTrackColumns->GetLabel(iTrack));
+    } else {
+      TIter nextTRACK(fTracks);
+      AliNanoAODTrack* track;
+      while ((track = static_cast<AliNanoAODTrack*>(nextTRACK())))
+        trackLabels.push_back(track->GetLabel());
+    }
+    for (std::vector<Int_t>::const_iterator itLabel = trackLabels.begin(); itLabel != trackLabels.end(); ++itLabel) {
+      Int_t label = TMath::Abs(*itLabel);
       while (label >= 0) {
         SelectParticle(label);
         AliAODMCParticle* mother = static_cast<AliAODMCParticle*>(mcParticles
@@ -539,13 +552,21 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
     
     // now remap the tracks...
   
-    TIter nextTrack(fTracks);
-    AliNanoAODTrack* t;
-    //      std::cout << "Remapping tracks" << std::endl;
-  
-    while ( ( t = dynamic_cast<AliNanoAODTrack*>(nextTrack()) ) )
+    if (fTrackColumns)
     {
-      t->SetLabel(GetNewLabel(t->GetLabel()));
+      for (Int_t iTrack = 0; iTrack < fTrackColumns->GetNumberOfTracks(); iTrack++)
+        fTrackColumns->SetLabel(iTrack, GetNewLabel(fTrackColumns->GetLabel(iTrack)));
+    }
+    else
+    {
+      TIter nextTrack(fTracks);
+      AliNanoAODTrack* t;
+      //      std::cout << "Remapping tracks" << std::endl;
+  
+      while ( ( t = dynamic_cast<AliNanoAODTrack*>(nextTrack()) ) )
+      {
+        t->SetLabel(GetNewLabel(t->GetLabel()));
+      }
     }
   }
   
@@ -569,12 +590,28 @@ TList* AliNanoAODReplicator::GetList() const
           AliFatal("Conversion Photons requested but field 'id' missing in track variables");
       }
       
+      // V0s, cascades and photons keep references to the daughter track objects
+      if (fColumnarTracks && (fSaveV0s || fSaveCascades || fSaveConversionPhotons))
+        AliFatal("Columnar tracks cannot be combined with V0s, cascades or conversion photons");
+      
       fList = new TList;
       fList->SetOwner(kTRUE);
 
-      fTracks = new TClonesArray("AliNanoAODTrack");
-      fTracks->SetName(fOutputArrayName.Data());
-      fList->Add(fTracks);
+      if (fColumnarTracks) {
+        // AliAODEvent::GetStdContent takes the object called "tracks" as TClonesArray
+        TString columnsName(fOutputArrayName);
+        if (columnsName == "tracks") {
+          columnsName = "trackColumns";
+          AliInfo(Form("Columnar tracks are stored as '%s'", columnsName.Data()));
+        }
+        AliNanoAODTrackMapping::GetInstance(fVarList);
+        fTrackColumns = new AliNanoAODTrackColumns(columnsName.Data(), AliNanoAODTrackMapping::GetInstance()->GetSize(), AliNanoAODTrackMapping::GetInstance()->GetSizeInt());
+        fList->Add(fTrackColumns);
+      } else {
+        fTracks = new TClonesArray("AliNanoAODTrack");
+        fTracks->SetName(fOutputArrayName.Data());
+        fList->Add(fTracks);
+      }
 
       Int_t numberOfHeaderParam = 0;
       Int_t numberOfHeaderParamInt = 0;
@@ -662,7 +699,10 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 {
   // Replicate (and filter if filters are there) the relevant parts we're interested in AODEvent
   
-  fTracks->Clear("C");
+  if (fTrackColumns)
+    fTrackColumns->Clear();
+  else
+    fTracks->Clear("C");
   
   assert(fVertices!=0x0);
   fVertices->Clear("C");
@@ -850,6 +890,15 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     if (!selected)
       continue;
 
+    if (fTrackColumns) {
+      // the track is only built to run the custom setters, then copied into the columns
+      AliNanoAODTrack nanoTrack(aodtrack, fVarList);
+      for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
+        (*it)->SetNanoAODTrack(aodtrack, &nanoTrack);
+      fTrackColumns->AddTrack(&nanoTrack);
+      continue;
+    }
+
     AliNanoAODTrack* nanoTrack = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
 
     for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
@@ -858,6 +907,9 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     trackAssociation[aodtrack] = nanoTrack;
   }
   
+  if (fTrackColumns)
+    fTrackColumns->Finish();
+  
   // Replace references to stored tracks. 
   // NOTE this has to respect the order in which they were stored (e.g. for a V0 the first daugther needs to be the positive one).
   for (std::map<AliAODVertex*, std::vector<TObject*> >::iterator it = fKeepDaughters.begin(); it != fKeepDaughters.end(); it++) {
@@ -878,7 +930,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     }
   }
   
-  AliDebug(1,Form("tracks=%d vertices=%d", fTracks->GetEntries(),fVertices->GetEntries())); 
+  AliDebug(1,Form("tracks=%d vertices=%d", fTrackColumns ? fTrackColumns->GetNumberOfTracks() : fTracks->GetEntries(),fVertices->GetEntries())); 
   
   // Finally, deal with MC information, if needed
   if ( fMCMode > 0 ) {
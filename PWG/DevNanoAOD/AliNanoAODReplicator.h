@@ -49,6 +49,7 @@ class AliAODHeader;
 class AliNanoAODHeader;
 class AliAnalysisTaskSE;
 class AliNanoAODTrack;
+class AliNanoAODTrackColumns;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
@@ -95,6 +96,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   
   void SetInputArrayName(TString name) {fInputArrayName=name;}
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
+  void SetColumnarTracks(Bool_t b = kTRUE) { fColumnarTracks = b; } // stored as "trackColumns" unless another output array name is set
 
   void SetVarListHeaderTC(TString var) {fVarListHeader_fTC=var;}
     
@@ -117,6 +119,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
                                                       // matching of the V0s from here
   
   mutable TClonesArray* fTracks; //! internal array of arrays of NanoAOD tracks
+  mutable AliNanoAODTrackColumns* fTrackColumns; //! internal columnar storage of NanoAOD tracks (replaces fTracks if fColumnarTracks)
   mutable AliNanoAODHeader* fHeader; //! internal array of headers
  
   mutable TClonesArray* fVertices; //! internal array of vertices
@@ -152,6 +155,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
 
   TString fInputArrayName; // name of array if tracks are stored in a TObjectArray
   TString fOutputArrayName; // name of the output array, where the NanoAODTracks are stored
+  Bool_t fColumnarTracks; // if kTRUE tracks are stored column-wise in an AliNanoAODTrackColumns instead of a TClonesArray
   
   std::map<AliAODVertex*, std::vector<TObject*> > fKeepDaughters; //! Tracks needed as references to V0s and cascades
   std::map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
@@ -159,7 +163,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 8) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
@@ -0,0 +1,108 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+//-------------------------------------------------------------------------
+//     Columnar storage of NanoAOD tracks, see header for details
+//-------------------------------------------------------------------------
+
+#include "AliLog.h"
+
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
+
+ClassImp(AliNanoAODTrackColumns)
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::AliNanoAODTrackColumns() :
+  TNamed(),
+  fNVars(0),
+  fNVarsInt(0),
+  fNTracks(0),
+  fVars(),
+  fVarsInt(),
+  fLabels(),
+  fNanoFlags(),
+  fRowVars(),
+  fRowVarsInt()
+{
+  // default constructor
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::AliNanoAODTrackColumns(const char * name, Int_t nVars, Int_t nVarsInt) :
+  TNamed(name, name),
+  fNVars(nVars),
+  fNVarsInt(nVarsInt),
+  fNTracks(0),
+  fVars(),
+  fVarsInt(),
+  fLabels(),
+  fNanoFlags(),
+  fRowVars(),
+  fRowVarsInt()
+{
+  // constructor: nVars and nVarsInt are the sizes given by AliNanoAODTrackMapping
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::Clear(Option_t * /*opt*/)
+{
+  // empty storage, keeping the allocated memory for the next event
+  fNTracks = 0;
+  fVars.clear();
+  fVarsInt.clear();
+  fLabels.clear();
+  fNanoFlags.clear();
+  fRowVars.clear();
+  fRowVarsInt.clear();
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::AddTrack(const AliNanoAODTrack * track)
+{
+  // append the content of track. Columns are only valid after Finish()
+
+  for (Int_t index = 0; index < fNVars; index++)
+    fRowVars.push_back(track->GetVar(index));
+  for (Int_t index = 0; index < fNVarsInt; index++)
+    fRowVarsInt.push_back(track->GetVarInt(index));
+
+  fLabels.push_back(track->GetLabel());
+  fNanoFlags.push_back(track->GetNanoFlags());
+  fNTracks++;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::Finish()
+{
+  // transpose the row-wise buffers into one block per variable
+
+  if (Int_t(fLabels.size()) != fNTracks)
+    AliFatal(Form("Inconsistent number of tracks: %d labels for %d tracks", Int_t(fLabels.size()), fNTracks));
+
+  fVars.resize(fNVars*fNTracks);
+  for (Int_t row = 0; row < fNTracks; row++)
+    for (Int_t index = 0; index < fNVars; index++)
+      fVars[index*fNTracks + row] = fRowVars[row*fNVars + index];
+
+  fVarsInt.resize(fNVarsInt*fNTracks);
+  for (Int_t row = 0; row < fNTracks; row++)
+    for (Int_t index = 0; index < fNVarsInt; index++)
+      fVarsInt[index*fNTracks + row] = fRowVarsInt[row*fNVarsInt + index];
+
+  fRowVars.clear();
+  fRowVarsInt.clear();
+}
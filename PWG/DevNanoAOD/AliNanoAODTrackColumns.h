@@ -0,0 +1,75 @@
+#ifndef ALINANOAODTRACKCOLUMNS_H
+#define ALINANOAODTRACKCOLUMNS_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+
+//-------------------------------------------------------------------------
+//     Columnar storage of NanoAOD tracks
+//     Alternative to a TClonesArray of AliNanoAODTrack: the variables
+//     configured in the AliNanoAODTrackMapping are stored in one
+//     contiguous block per variable (all pt values, then all phi
+//     values, ...). Similar values end up next to each other in the
+//     output, which compresses better, and tasks which only use a few
+//     variables read them as plain arrays.
+//     Tracks are accessed either column by column (GetColumn) or with
+//     the AliVTrack interface through AliNanoAODTrackView.
+//     The object must not be called "tracks", which AliAODEvent takes
+//     as the TClonesArray of tracks.
+//-------------------------------------------------------------------------
+
+#include <TNamed.h>
+
+#include <vector>
+
+class AliNanoAODTrack;
+
+class AliNanoAODTrackColumns : public TNamed {
+
+public:
+  AliNanoAODTrackColumns();
+  AliNanoAODTrackColumns(const char * name, Int_t nVars, Int_t nVarsInt);
+  virtual ~AliNanoAODTrackColumns() {;}
+
+  virtual void Clear(Option_t * opt = "");
+
+  // filling: tracks are appended row by row, Finish() builds the columns
+  void AddTrack(const AliNanoAODTrack * track);
+  void Finish();
+
+  Int_t GetNumberOfTracks()  const { return fNTracks;  }
+  Int_t GetNumberOfVars()    const { return fNVars;    }
+  Int_t GetNumberOfVarsInt() const { return fNVarsInt; }
+
+  // column access: index as given by AliNanoAODTrackMapping
+  const Double32_t * GetColumn(Int_t index)    const { return fNTracks > 0 ? &fVars[index*fNTracks] : 0;    }
+  const Int_t      * GetColumnInt(Int_t index) const { return fNTracks > 0 ? &fVarsInt[index*fNTracks] : 0; }
+
+  // row access
+  Double_t GetVar(Int_t row, Int_t index)    const { return fVars[index*fNTracks + row];    }
+  Int_t    GetVarInt(Int_t row, Int_t index) const { return fVarsInt[index*fNTracks + row]; }
+  Int_t    GetLabel(Int_t row)               const { return fLabels[row];    }
+  UInt_t   GetNanoFlags(Int_t row)           const { return fNanoFlags[row]; }
+
+  void SetLabel(Int_t row, Int_t label) { fLabels[row] = label; }
+
+private:
+  AliNanoAODTrackColumns(const AliNanoAODTrackColumns&);
+  AliNanoAODTrackColumns& operator=(const AliNanoAODTrackColumns&);
+
+  Int_t fNVars;      // number of floating point variables per track
+  Int_t fNVarsInt;   // number of integer variables per track
+  Int_t fNTracks;    // number of tracks in this event
+
+  std::vector<Double32_t> fVars;      // floating point variables, one block of fNTracks values per variable
+  std::vector<Int_t>      fVarsInt;   // integer variables, one block of fNTracks values per variable
+  std::vector<Int_t>      fLabels;    // track labels, point back to MC particles
+  std::vector<UInt_t>     fNanoFlags; // AliNanoAODTrack::ENanoFlags bits
+
+  std::vector<Double32_t> fRowVars;    //! row-wise buffer used while filling
+  std::vector<Int_t>      fRowVarsInt; //! row-wise buffer used while filling
+
+  ClassDef(AliNanoAODTrackColumns, 1);
+};
+
+#endif
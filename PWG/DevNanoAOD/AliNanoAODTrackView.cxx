@@ -0,0 +1,118 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+//-------------------------------------------------------------------------
+//     View of one track of an AliNanoAODTrackColumns, see header
+//-------------------------------------------------------------------------
+
+#include "AliLog.h"
+#include "AliDetectorPID.h"
+
+#include "AliNanoAODTrackView.h"
+
+ClassImp(AliNanoAODTrackView)
+
+//______________________________________________________________________________
+AliNanoAODTrackView::AliNanoAODTrackView() :
+  AliVTrack(),
+  fColumns(0),
+  fRow(0),
+  fMapping(AliNanoAODTrackMapping::GetInstance()),
+  fDetectorPID(0)
+{
+  // default constructor
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackView::AliNanoAODTrackView(const AliNanoAODTrackColumns * columns, Int_t row) :
+  AliVTrack(),
+  fColumns(columns),
+  fRow(row),
+  fMapping(AliNanoAODTrackMapping::GetInstance()),
+  fDetectorPID(0)
+{
+  // constructor: the mapping has to be loaded already (it is, once the
+  // NanoAOD file is open)
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackView::AliNanoAODTrackView(const AliNanoAODTrackView& view) :
+  AliVTrack(view),
+  fColumns(view.fColumns),
+  fRow(view.fRow),
+  fMapping(view.fMapping),
+  fDetectorPID(0)
+{
+  // copy constructor, the PID object stays with the original view
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackView::~AliNanoAODTrackView()
+{
+  // destructor
+  delete fDetectorPID;
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackView& AliNanoAODTrackView::operator=(const AliNanoAODTrackView& view)
+{
+  // assignment operator
+  if (this != &view) {
+    AliVTrack::operator=(view);
+    SetDetectorPID(0);
+    fColumns = view.fColumns;
+    fRow     = view.fRow;
+    fMapping = view.fMapping;
+  }
+  return *this;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackView::SetDetectorPID(const AliDetectorPID *pid)
+{
+  /// Set the detector PID of the current row
+
+  if (fDetectorPID && fDetectorPID != pid) delete fDetectorPID;
+  fDetectorPID = pid;
+}
+
+//______________________________________________________________________________
+Double_t AliNanoAODTrackView::GetPIDVar(AliNanoAODTrack::ENanoPIDResponse r, AliPID::EParticleType p) const
+{
+  static Bool_t pidAvailable = AliNanoAODTrack::InitPIDIndex();
+  Int_t index = pidAvailable ? AliNanoAODTrack::GetPIDIndex(r, p) : -1;
+  return (index != -1) ? GetVar(index) : -999.;
+}
+
+//______________________________________________________________________________
+Double_t AliNanoAODTrackView::GetCustomVar(const char * name) const
+{
+  // only custom variables are looked up, the standard ones can be integers
+  TString varName(name);
+  if (!varName.BeginsWith("cst") && !varName.BeginsWith("PID."))
+    return -999.;
+  Int_t index = fMapping->GetVarIndex(varName);
+  return (index != -1) ? GetVar(index) : -999.;
+}
+
+//______________________________________________________________________________
+Bool_t AliNanoAODTrackView::GetCovarianceXYZPxPyPz(Double_t cv[21]) const
+{
+  for (Int_t i=0; i<21; i++)
+    cv[i] = GetVar(fMapping->GetCovMat(i));
+
+  return kTRUE;
+}
@@ -0,0 +1,176 @@
+#ifndef ALINANOAODTRACKVIEW_H
+#define ALINANOAODTRACKVIEW_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+
+//-------------------------------------------------------------------------
+//     View of one track of an AliNanoAODTrackColumns
+//     Exposes the AliVTrack interface of AliNanoAODTrack over a row of
+//     the columnar storage without copying the variables. The view is
+//     transient and read-only: move it along the event with SetRow.
+//     The mapping indices are cached at construction. A detector PID
+//     object set by AliPIDResponse belongs to the current row and is
+//     deleted when the view moves to another track.
+//-------------------------------------------------------------------------
+
+#include "AliVTrack.h"
+#include "AliAODTrack.h"
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
+#include "AliNanoAODTrackMapping.h"
+
+class AliDetectorPID;
+
+class AliNanoAODTrackView : public AliVTrack {
+
+public:
+  using TObject::ClassName;
+
+  AliNanoAODTrackView();
+  AliNanoAODTrackView(const AliNanoAODTrackColumns * columns, Int_t row = 0);
+  virtual ~AliNanoAODTrackView();
+  AliNanoAODTrackView(const AliNanoAODTrackView& view);
+  AliNanoAODTrackView& operator=(const AliNanoAODTrackView& view);
+
+  void  SetColumns(const AliNanoAODTrackColumns * columns) { if (columns != fColumns) SetDetectorPID(0); fColumns = columns; }
+  void  SetRow(Int_t row) { if (row != fRow) SetDetectorPID(0); fRow = row; }
+  Int_t GetRow() const { return fRow; }
+  const AliNanoAODTrackColumns * GetColumns() const { return fColumns; }
+
+  Double_t GetVar(Int_t index)    const { return fColumns->GetVar(fRow, index);    }
+  Int_t    GetVarInt(Int_t index) const { return fColumns->GetVarInt(fRow, index); }
+
+  UInt_t GetNanoFlags() const { return fColumns->GetNanoFlags(fRow); }
+  virtual Short_t Charge() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kNanoCharge) ? 1 : -1; }
+  virtual Bool_t  HasPointOnITSLayer(Int_t i) const { return TESTBIT(GetNanoFlags(), i+AliNanoAODTrack::kNanoClusterITS0); }
+
+  // kinematics
+  virtual Double_t OneOverPt() const { return (Pt() != 0.) ? 1./Pt() : -999.; }
+  virtual Double_t Phi()       const { return GetVar(fMapping->GetPhi());   }
+  virtual Double_t Theta()     const { return GetVar(fMapping->GetTheta()); }
+
+  virtual Double_t Px() const { return Pt() * TMath::Cos(Phi()); }
+  virtual Double_t Py() const { return Pt() * TMath::Sin(Phi()); }
+  virtual Double_t Pz() const { return Pt() / TMath::Tan(Theta()); }
+  virtual Double_t Pt() const { return GetVar(fMapping->GetPt()); }
+  virtual Double_t P()  const { return TMath::Sqrt(Pt()*Pt()+Pz()*Pz()); }
+  virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
+
+  virtual Double_t Xv() const { return -999.; }
+  virtual Double_t Yv() const { return -999.; }
+  virtual Double_t Zv() const { return -999.; }
+  virtual Bool_t   XvYvZv(Double_t x[3]) const { x[0] = Xv(); x[1] = Yv(); x[2] = Zv(); return kTRUE; }
+
+  Double_t Chi2perNDF()  const { return GetVar(fMapping->GetChi2PerNDF()); }
+  virtual UShort_t GetTPCncls(Int_t /*row0*/=0, Int_t /*row1*/=159)  const { return GetVarInt(fMapping->GetTPCncls()); }
+  virtual UShort_t GetTPCNcls()  const { return GetTPCncls(); }
+
+  virtual Double_t M() const { AliFatal("Not Implemented"); return -1; }
+  virtual Double_t E() const { AliFatal("Not Implemented"); return -1; }
+  Double_t E(Double_t m) const { return TMath::Sqrt(P()*P() + m*m); }
+  virtual Double_t Y() const { AliFatal("Not Implemented"); return  -1; }
+
+  virtual Double_t Eta() const { return -TMath::Log(TMath::Tan(0.5 * Theta())); }
+  virtual Double_t GetSign() const { return Charge(); }
+  virtual Bool_t   PropagateToDCA(const AliVVertex * /*vtx*/, Double_t /*b*/, Double_t /*maxd*/, Double_t /*dz*/[2], Double_t /*covar*/[3]) { AliFatal("Not Implemented: views are read-only"); return kFALSE; }
+
+  ULong64_t GetStatus() const { return (ULong64_t(GetVarInt(fMapping->GetStatus())) << 32) + GetVarInt(fMapping->GetStatus()+1); }
+
+  Int_t   GetID() const { return GetVar(fMapping->GetID()); }
+  Int_t   GetLabel() const { return fColumns->GetLabel(fRow); }
+  Int_t   PdgCode() const { return 0; }
+
+  template <typename T> Bool_t GetPosition(T *x) const {
+    x[0]=GetVar(fMapping->GetPosX()); x[1]=GetVar(fMapping->GetPosY()); x[2]=GetVar(fMapping->GetPosZ());
+    return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kIsDCA);}
+  Bool_t GetXYZ(Double_t *p) const { return GetPosition(p); }
+  Bool_t GetPxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
+  Bool_t GetCovarianceXYZPxPyPz(Double_t cv[21]) const;
+
+  Bool_t IsMuonTrack() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kIsMuonTrack); }
+
+  Double_t XAtDCA() const { return GetVar(fMapping->GetPosDCAx()); }
+  Double_t YAtDCA() const { return GetVar(fMapping->GetPosDCAy()); }
+  Double_t ZAtDCA() const { return GetVar(fMapping->GetPosDCAz()); }
+  Bool_t   XYZAtDCA(Double_t x[3]) const { x[0] = XAtDCA(); x[1] = YAtDCA(); x[2] = ZAtDCA(); return kTRUE; }
+  Double_t DCA() const { return GetVar(fMapping->GetDCA()); }
+
+  Double_t PxAtDCA() const { return GetVar(fMapping->GetPDCAX()); }
+  Double_t PyAtDCA() const { return GetVar(fMapping->GetPDCAY()); }
+  Double_t PzAtDCA() const { return GetVar(fMapping->GetPDCAZ()); }
+  Bool_t   PxPyPzAtDCA(Double_t p[3]) const { p[0] = PxAtDCA(); p[1] = PyAtDCA(); p[2] = PzAtDCA(); return kTRUE; }
+
+  UChar_t  GetITSClusterMap() const { AliFatal("Not Implemented. Use HasPointOnITSLayer!"); return 0; }
+  Float_t  GetTPCClusterInfo(Int_t /*nNeighbours=3*/, Int_t /*type=0*/, Int_t /*row0=0*/, Int_t /*row1=159*/, Int_t /*type*/=0) const { AliFatal("Not Implemented"); return 0; }
+
+  Bool_t   TestFilterBit(UInt_t filterBit) const { return (Bool_t) ((filterBit & GetFilterMap()) != 0); }
+  UInt_t   GetFilterMap() const { return GetVarInt(fMapping->GetFilterMap()); }
+
+  UShort_t GetTPCNclsF() const { return GetVarInt(fMapping->GetTPCnclsF()); }
+  UShort_t GetTPCnclsS() const { return GetVarInt(fMapping->GetTPCnclsS()); }
+  UShort_t GetTPCNCrossedRows()  const { return GetVarInt(fMapping->GetTPCNCrossedRows()); }
+  Float_t  GetTPCFoundFraction() const { return GetTPCNCrossedRows()>0 ? float(GetTPCNcls())/GetTPCNCrossedRows() : 0; }
+
+  Double_t GetTrackPhiOnEMCal() const { return GetVar(fMapping->GetTrackPhiOnEMCal()); }
+  Double_t GetTrackEtaOnEMCal() const { return GetVar(fMapping->GetTrackEtaOnEMCal()); }
+  Double_t GetTrackPtOnEMCal()  const { return GetVar(fMapping->GetTrackPtOnEMCal());  }
+
+  // pid signal interface
+  Double_t GetITSsignal()       const { return GetVar(fMapping->GetITSsignal()); }
+  Double_t GetTPCsignal()       const { return GetVar(fMapping->GetTPCsignal()); }
+  Double_t GetTPCsignalTunedOnData() const { return GetVar(fMapping->GetTPCsignalTuned()); }
+  UShort_t GetTPCsignalN()      const { return GetVarInt(fMapping->GetTPCsignalN()); }
+  Double_t GetTPCmomentum()     const { return GetVar(fMapping->GetTPCmomentum()); }
+  Double_t GetTPCTgl()          const { return GetVar(fMapping->GetTPCTgl()); }
+  Double_t GetTOFsignal()       const { return GetVar(fMapping->GetTOFsignal()); }
+  Double_t GetIntegratedLength() const { return GetVar(fMapping->GetintegratedLength()); }
+  Double_t GetTOFsignalTunedOnData() const { return GetVar(fMapping->GetTOFsignalTuned()); }
+  Double_t GetHMPIDsignal()     const { return GetVar(fMapping->GetHMPIDsignal()); }
+  Double_t GetHMPIDoccupancy()  const { return GetVar(fMapping->GetHMPIDoccupancy()); }
+  Int_t    GetTOFBunchCrossing(Double_t /*b=0*/, Bool_t /*tpcPIDonly=kFALSE*/) const { return GetVar(fMapping->GetTOFBunchCrossing()); }
+  Double_t GetTRDsignal()       const { return GetVar(fMapping->GetTRDsignal()); }
+  Double_t GetTRDchi2()         const { return GetVar(fMapping->GetTRDChi2()); }
+  Int_t    GetNumberOfTRDslices() const { return GetVar(fMapping->GetTRDnSlices()); }
+
+  virtual void GetIntegratedTimes(Double_t */*times*/, Int_t) const { AliFatal("Not implemented"); return; }
+  UChar_t  GetTRDncls(Int_t /*layer*/)                           const { AliFatal("Not Implemented"); return 0; }
+  UChar_t  GetTRDncls()                                          const { return GetTRDncls(-1); }
+  Double_t GetTRDslice(Int_t /*plane*/, Int_t /*slice*/)         const { AliFatal("Not Implemented"); return 0; }
+  Double_t GetTRDmomentum(Int_t /*plane*/, Double_t */*sp*/=0x0) const { AliFatal("Not Implemented"); return 0; }
+
+  //  needed  to inherit from VTrack, but not implemented
+  virtual UChar_t  GetTRDntrackletsPID() const { return GetVarInt(fMapping->GetTRDntrackletsPID()); }
+  virtual void     GetHMPIDpid(Double_t */*p*/) const { AliFatal("Not Implemented"); return; }
+  virtual Double_t GetBz() const { AliFatal("Not Implemented"); return 0; }
+  virtual void     GetBxByBz(Double_t [3]/*b[3]*/) const { AliFatal("Not Implemented"); return; }
+  virtual const    AliExternalTrackParam * GetOuterParam() const { AliFatal("Not Implemented"); return 0; }
+  virtual const    AliExternalTrackParam * GetInnerParam() const { AliFatal("Not Implemented"); return 0; }
+  virtual Int_t    GetNcls(Int_t /*idet*/) const { AliFatal("Not Implemented"); return 0; }
+  virtual const Double_t *PID() const { AliFatal("Not Implemented"); return 0; }
+
+  virtual void GetImpactParameters(Float_t &xy,Float_t &z) const { xy = DCA(); z = ZAtDCA(); }
+
+  // Transient PID object of the current row, is owned by the view
+  virtual void  SetDetectorPID(const AliDetectorPID *pid);
+  virtual const AliDetectorPID* GetDetectorPID() const { return fDetectorPID; }
+
+  // PID variables stored with AliAnalysisTaskNanoAODFilter::AddPIDField, -999 if not stored
+  Double_t GetPIDVar(AliNanoAODTrack::ENanoPIDResponse r, AliPID::EParticleType p) const;
+  // custom variables ("cst..." and "PID...") by name, -999 if not stored
+  Double_t GetCustomVar(const char * name) const;
+
+  bool IsTRDrefit() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kTRDrefit); }
+  bool HasTOFpid() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kNanoHasTOFPID); }
+
+private:
+
+  const AliNanoAODTrackColumns * fColumns; //! storage this view points into
+  Int_t fRow;                              //! current track
+  AliNanoAODTrackMapping * fMapping;       //! cached mapping instance
+  const AliDetectorPID * fDetectorPID;     //! transient object to cache calibrated PID information of the current row
+
+  ClassDef(AliNanoAODTrackView, 1);
+};
+
+#endif
@@ -151,7 +151,7 @@ AliVCluster* AliClusterContainer::GetAcceptCluster(Int_t i) const
   if (!vc) return 0;
 
   UInt_t rejectionReason = 0;
-  if (AcceptCluster(vc, rejectionReason))
+  if (AcceptObjectCached(i, rejectionReason))
     return vc;
   else {
     AliDebug(2,"Cluster not accepted.");
@@ -300,6 +300,7 @@ Bool_t AliClusterContainer::GetNextMomentum(TLorentzVector &mom)
  */
 Bool_t AliClusterContainer::GetAcceptMomentum(TLorentzVector &mom, Int_t i) const
 {
+  if (GetCachedAcceptMomentum(mom, i)) return kTRUE;
   AliVCluster *vc = GetAcceptCluster(i);
   return GetMomentum(mom, vc);
 }
@@ -312,6 +313,7 @@ Bool_t AliClusterContainer::GetAcceptMomentum(TLorentzVector &mom, Int_t i) cons
 Bool_t AliClusterContainer::GetNextAcceptMomentum(TLorentzVector &mom)
 {
   AliVCluster *vc = GetNextAcceptCluster();
+  if (vc && GetCachedAcceptMomentum(mom, fCurrentID)) return kTRUE;
   return GetMomentum(mom, vc);
 }
 
@@ -476,6 +478,7 @@ void AliClusterContainer::SetClusUserDefEnergyCut(Int_t t, Double_t cut)
   else {
     fMinE = cut;
   }
+  InvalidateAcceptCache();
 }
 
 /**
@@ -60,6 +60,15 @@ AliEmcalContainer::AliEmcalContainer():
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fCacheAcceptance(kFALSE),
+  fAcceptCacheEnabled(kFALSE),
+  fAcceptCacheValid(kFALSE),
+  fAcceptCacheReason(),
+  fAcceptCachePosition(),
+  fAcceptCacheIndices(),
+  fAcceptCacheMomenta(),
+  fNAcceptEvaluations(0),
+  fNAcceptCacheHits(0),
   fClassName()
 {
   fVertex[0] = 0;
@@ -90,6 +99,15 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fCacheAcceptance(kFALSE),
+  fAcceptCacheEnabled(kFALSE),
+  fAcceptCacheValid(kFALSE),
+  fAcceptCacheReason(),
+  fAcceptCachePosition(),
+  fAcceptCacheIndices(),
+  fAcceptCacheMomenta(),
+  fNAcceptEvaluations(0),
+  fNAcceptCacheHits(0),
   fClassName()
 {
   fVertex[0] = 0;
@@ -107,6 +125,7 @@ void AliEmcalContainer::SetClassName(const char *clname)
   TClass cls(clname);
   if (cls.InheritsFrom(fBaseClassName)) {
     fClassName = clname;
+    InvalidateAcceptCache();
   }
   else {
     AliError(Form("Unable to set class name %s for this container, it must inherits from %s!",clname,fBaseClassName.Data()));
@@ -133,6 +152,8 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
 
   GetVertexFromEvent(event);
 
+  fAcceptCacheValid = kFALSE;
+
   if (!fClArrayName.IsNull() && !fClArray) {
     fClArray = dynamic_cast<TClonesArray*>(event->FindListObject(fClArrayName));
     if (!fClArray) {
@@ -159,6 +180,12 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
 
 void AliEmcalContainer::NextEvent(const AliVEvent * event)
 {
+  // Acceptance cache is rebuilt lazily at the first accepted loop in the event
+  fAcceptCacheEnabled = fCacheAcceptance;
+  fAcceptCacheValid = kFALSE;
+  fNAcceptEvaluations = 0;
+  fNAcceptCacheHits = 0;
+
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
@@ -168,6 +195,12 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
 }
 
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  Bool_t rebuilt = kFALSE;
+  if (UpdateAcceptCache(&rebuilt)) {
+    if (!rebuilt) fNAcceptCacheHits += fAcceptCacheReason.size();
+    return fAcceptCacheIndices.size();
+  }
+
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
@@ -176,6 +209,66 @@ Int_t AliEmcalContainer::GetNAcceptEntries() const{
   return result;
 }
 
+Bool_t AliEmcalContainer::UpdateAcceptCache(Bool_t *rebuilt) const
+{
+  if (rebuilt) *rebuilt = kFALSE;
+  if (!fAcceptCacheEnabled) return kFALSE;
+
+  const Int_t n = GetNEntries();
+  if (fAcceptCacheValid && static_cast<Int_t>(fAcceptCacheReason.size()) == n) return kTRUE;
+
+  if (rebuilt) *rebuilt = kTRUE;
+
+  fAcceptCacheReason.assign(n, 0);
+  fAcceptCachePosition.assign(n, -1);
+  fAcceptCacheIndices.clear();
+  fAcceptCacheMomenta.clear();
+  for (Int_t index = 0; index < n; index++) {
+    UInt_t rejectionReason = 0;
+    fNAcceptEvaluations++;
+    if (AcceptObject(index, rejectionReason)) {
+      fAcceptCachePosition[index] = fAcceptCacheIndices.size();
+      fAcceptCacheIndices.push_back(index);
+      fAcceptCacheMomenta.push_back(AliTLorentzVector());
+      GetMomentum(fAcceptCacheMomenta.back(), index);
+    }
+    else {
+      fAcceptCacheReason[index] = rejectionReason;
+    }
+  }
+  fAcceptCacheValid = kTRUE;
+  return kTRUE;
+}
+
+const std::vector<Int_t> *AliEmcalContainer::GetAcceptCache() const
+{
+  Bool_t rebuilt = kFALSE;
+  if (!UpdateAcceptCache(&rebuilt)) return 0;
+  if (!rebuilt) fNAcceptCacheHits += fAcceptCacheReason.size();
+  return &fAcceptCacheIndices;
+}
+
+Bool_t AliEmcalContainer::GetCachedAcceptMomentum(TLorentzVector &mom, Int_t i) const
+{
+  if (!UpdateAcceptCache()) return kFALSE;
+  if (i < 0 || i >= static_cast<Int_t>(fAcceptCachePosition.size())) return kFALSE;
+  Int_t pos = fAcceptCachePosition[i];
+  if (pos < 0) return kFALSE;
+  mom = fAcceptCacheMomenta[pos];
+  return kTRUE;
+}
+
+Bool_t AliEmcalContainer::AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const
+{
+  Bool_t rebuilt = kFALSE;
+  if (UpdateAcceptCache(&rebuilt) && i >= 0 && i < static_cast<Int_t>(fAcceptCacheReason.size())) {
+    if (!rebuilt) fNAcceptCacheHits++;
+    rejectionReason |= fAcceptCacheReason[i];
+    return fAcceptCachePosition[i] >= 0;
+  }
+  return AcceptObject(i, rejectionReason);
+}
+
 Int_t AliEmcalContainer::GetIndexFromLabel(Int_t lab) const
 { 
   if (fLabelMap) {
@@ -37,8 +37,10 @@ class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
 
+#include <vector>
 #include <TNamed.h>
 #include <TClonesArray.h>
+#include "AliTLorentzVector.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterableContainer::operator_star_object<TObject> > AliEmcalIterableContainer;
@@ -229,6 +231,60 @@ class AliEmcalContainer : public TObject {
    */
   Int_t                       GetNAcceptEntries() const;
 
+  /**
+   * @brief Get the per-event cache of accepted indices
+   *
+   * The acceptance of all objects in the container is evaluated once after
+   * each call to NextEvent, together with the momentum of the accepted objects.
+   * Subsequent accepted loops within the same event read the cached result.
+   * @return Sorted indices of accepted objects, NULL if the cache is not active
+   */
+  const std::vector<Int_t>   *GetAcceptCache() const;
+
+  /**
+   * @brief Look up the cached momentum of an accepted object
+   * @param[out] mom Momentum of the object at index i
+   * @param[in] i Index of the object in the container
+   * @return True if the cache is active and the object is accepted, false otherwise
+   */
+  Bool_t                      GetCachedAcceptMomentum(TLorentzVector &mom, Int_t i) const;
+
+  /**
+   * @brief Check whether the object at index i is accepted, using the per-event cache when active
+   *
+   * Falls back to AcceptObject in case the cache is not active.
+   * @param[in] i Index of the object in the container
+   * @param[out] rejectionReason Bitmap for reason why object is rejected
+   * @return True if the object is accepted, false otherwise
+   */
+  Bool_t                      AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const;
+
+  /**
+   * @brief Enable/disable the per-event acceptance cache (off by default)
+   *
+   * Only to be enabled for containers whose objects do not change within the
+   * event after the first accepted loop. Not the case e.g. for jets whose tag
+   * status is set by the task, or for clusters whose energies are modified in
+   * place, unless InvalidateAcceptCache is called after each modification.
+   * Changing a selection setting invalidates the cache.
+   * @param[in] b If true the acceptance is cached after each call to NextEvent
+   */
+  void                        SetCacheAcceptance(Bool_t b)          { fCacheAcceptance = b; InvalidateAcceptCache(); }
+  Bool_t                      GetCacheAcceptance()            const { return fCacheAcceptance           ; }
+  void                        InvalidateAcceptCache()               { fAcceptCacheValid = kFALSE        ; }
+
+  /**
+   * @brief Number of acceptance checks served from the cache in the current event
+   * @return Number of avoided re-evaluations of the object selection
+   */
+  Long64_t                    GetNAcceptCacheHits()           const { return fNAcceptCacheHits          ; }
+
+  /**
+   * @brief Number of acceptance evaluations done to build the cache in the current event
+   * @return Number of evaluations of the object selection
+   */
+  Long64_t                    GetNAcceptEvaluations()         const { return fNAcceptEvaluations        ; }
+
   /**
    * @brief Reset the iterator to a given index
    * 
@@ -246,10 +302,10 @@ class AliEmcalContainer : public TObject {
    * @param event Input event containing the array with content.
    */
   virtual void                SetArray(const AliVEvent *event);
-  void                        SetArrayName(const char *n)           { fClArrayName = n                  ; }
-  void                        SetVertex(Double_t *vtx)              { memcpy(fVertex, vtx, sizeof(Double_t) * 3); }
-  void                        SetBitMap(UInt_t m)                   { fBitMap = m                       ; }
-  void                        SetIsParticleLevel(Bool_t b)          { fIsParticleLevel = b              ; }
+  void                        SetArrayName(const char *n)           { fClArrayName = n                  ; InvalidateAcceptCache(); }
+  void                        SetVertex(Double_t *vtx)              { memcpy(fVertex, vtx, sizeof(Double_t) * 3); InvalidateAcceptCache(); }
+  void                        SetBitMap(UInt_t m)                   { fBitMap = m                       ; InvalidateAcceptCache(); }
+  void                        SetIsParticleLevel(Bool_t b)          { fIsParticleLevel = b              ; InvalidateAcceptCache(); }
   void                        SortArray()                           { fClArray->Sort()                  ; }
 
   TClass*                     GetLoadedClass()                      { return fLoadedClass               ; }
@@ -259,18 +315,18 @@ class AliEmcalContainer : public TObject {
    * @param[in] event The event to be processed.
    */
   virtual void                NextEvent(const AliVEvent *event);
-  void                        SetMinMCLabel(Int_t s)                            { fMinMCLabel      = s   ; }
-  void                        SetMaxMCLabel(Int_t s)                            { fMaxMCLabel      = s   ; }
+  void                        SetMinMCLabel(Int_t s)                            { fMinMCLabel      = s   ; InvalidateAcceptCache(); }
+  void                        SetMaxMCLabel(Int_t s)                            { fMaxMCLabel      = s   ; InvalidateAcceptCache(); }
   void                        SetMCLabelRange(Int_t min, Int_t max)             { SetMinMCLabel(min)     ; SetMaxMCLabel(max)    ; }
-  void                        SetELimits(Double_t min, Double_t max)    { fMinE   = min ; fMaxE   = max ; }
-  void                        SetMinE(Double_t min)                     { fMinE   = min ; }
-  void                        SetMaxE(Double_t max)                     { fMaxE   = max ; }
-  void                        SetPtLimits(Double_t min, Double_t max)   { fMinPt  = min ; fMaxPt  = max ; }
-  void                        SetMinPt(Double_t min)                    { fMinPt  = min ; }
-  void                        SetMaxPt(Double_t max)                    { fMaxPt  = max ; }
-  void                        SetEtaLimits(Double_t min, Double_t max)  { fMaxEta = max ; fMinEta = min ; }
-  void                        SetPhiLimits(Double_t min, Double_t max)  { fMaxPhi = max ; fMinPhi = min ; }
-  void                        SetMassHypothesis(Double_t m)             { fMassHypothesis         = m   ; }
+  void                        SetELimits(Double_t min, Double_t max)    { fMinE   = min ; fMaxE   = max ; InvalidateAcceptCache(); }
+  void                        SetMinE(Double_t min)                     { fMinE   = min ; InvalidateAcceptCache(); }
+  void                        SetMaxE(Double_t max)                     { fMaxE   = max ; InvalidateAcceptCache(); }
+  void                        SetPtLimits(Double_t min, Double_t max)   { fMinPt  = min ; fMaxPt  = max ; InvalidateAcceptCache(); }
+  void                        SetMinPt(Double_t min)                    { fMinPt  = min ; InvalidateAcceptCache(); }
+  void                        SetMaxPt(Double_t max)                    { fMaxPt  = max ; InvalidateAcceptCache(); }
+  void                        SetEtaLimits(Double_t min, Double_t max)  { fMaxEta = max ; fMinEta = min ; InvalidateAcceptCache(); }
+  void                        SetPhiLimits(Double_t min, Double_t max)  { fMaxPhi = max ; fMinPhi = min ; InvalidateAcceptCache(); }
+  void                        SetMassHypothesis(Double_t m)             { fMassHypothesis         = m   ; InvalidateAcceptCache(); }
   void                        SetClassName(const char *clname);
 
   /**
@@ -279,7 +335,7 @@ class AliEmcalContainer : public TObject {
    * Embedding means that the container consists only of tracks from the embedded event.
    * @param[in] b If true the container handles the embedded event
    */
-  void                        SetIsEmbedding(Bool_t b)                  { fIsEmbedding = b ; }
+  void                        SetIsEmbedding(Bool_t b)                  { fIsEmbedding = b ; InvalidateAcceptCache(); }
 
   /**
    * @brief Get embedding status
@@ -372,6 +428,14 @@ class AliEmcalContainer : public TObject {
    */
   void                        GetVertexFromEvent(const AliVEvent * event);
 
+  /**
+   * @brief (Re)build the acceptance cache if needed
+   * @param[out] rebuilt If not null, set to true if the cache was (re)built in this call,
+   * false if it was found valid (only the latter counts as cache hit)
+   * @return True if the cache is active and valid, false otherwise
+   */
+  Bool_t                      UpdateAcceptCache(Bool_t *rebuilt = 0) const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -394,6 +458,15 @@ class AliEmcalContainer : public TObject {
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  Bool_t                      fCacheAcceptance;         ///< cache acceptance and momenta of accepted objects once per event (opt-in)
+  Bool_t                      fAcceptCacheEnabled;      //!<! cache requested and container prepared via NextEvent
+  mutable Bool_t              fAcceptCacheValid;        //!<! cache content corresponds to the current event
+  mutable std::vector<UInt_t> fAcceptCacheReason;       //!<! rejection reason of each object
+  mutable std::vector<Int_t>  fAcceptCachePosition;     //!<! position of each object in the list of accepted objects (-1 if rejected)
+  mutable std::vector<Int_t>  fAcceptCacheIndices;      //!<! indices of accepted objects
+  mutable std::vector<AliTLorentzVector> fAcceptCacheMomenta; //!<! momenta of accepted objects
+  mutable Long64_t            fNAcceptEvaluations;      //!<! number of acceptance evaluations in the current event
+  mutable Long64_t            fNAcceptCacheHits;        //!<! number of acceptance checks served from the cache in the current event
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -401,6 +474,6 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer(const AliEmcalContainer& obj); // copy constructor
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
 };
 #endif
@@ -151,7 +151,10 @@ public:
       }
       else {
         this->fCurrentElement.second = (*fkData)[fCurrent];
-        fkData->GetContainer()->GetMomentum(this->fCurrentElement.first, fkData->GetInternalIndex(fCurrent));
+        int index = fkData->GetInternalIndex(fCurrent);
+        // accepted objects: momentum from the per-event cache of the container if available
+        if (!fkData->fUseAccepted || !fkData->GetContainer()->GetCachedAcceptMomentum(this->fCurrentElement.first, index))
+          fkData->GetContainer()->GetMomentum(this->fCurrentElement.first, index);
       }
     }
   };
@@ -329,10 +332,17 @@ T *AliEmcalIterableContainerT<T, STAR>::operator[](int index) const {
 /**
  * Build list of accepted indices inside the container.
  * For this all objects inside the container are checked
- * for being accepted or not.
+ * for being accepted or not, unless the container provides
+ * the accepted indices from its per-event cache.
  */
 template <typename T, typename STAR>
 void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
+  const std::vector<Int_t> *cache = fkContainer->GetAcceptCache();
+  if (cache) {
+    fAcceptIndices.Set(cache->size(), cache->empty() ? 0 : &(cache->front()));
+    return;
+  }
+
   fAcceptIndices.Set(fkContainer->GetNAcceptEntries());
   int acceptCounter = 0;
   for(int index = 0; index < fkContainer->GetNEntries(); index++){
@@ -114,7 +114,7 @@ AliVParticle* AliParticleContainer::GetAcceptParticle(Int_t i) const
 {
   UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
-  if (AcceptParticle(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetParticle(i);
   }
   else {
@@ -239,6 +239,7 @@ Bool_t AliParticleContainer::GetNextMomentum(TLorentzVector &mom)
 Bool_t AliParticleContainer::GetAcceptMomentum(TLorentzVector &mom, Int_t i) const
 {
   if (i == -1) i = fCurrentID;
+  if (GetCachedAcceptMomentum(mom, i)) return kTRUE;
   AliVParticle *vp = GetAcceptParticle(i);
   return GetMomentumFromParticle(mom, vp);
 }
@@ -255,6 +256,7 @@ Bool_t AliParticleContainer::GetAcceptMomentum(TLorentzVector &mom, Int_t i) con
 Bool_t AliParticleContainer::GetNextAcceptMomentum(TLorentzVector &mom)
 {
   AliVParticle *vp = GetNextAcceptParticle();
+  if (vp && GetCachedAcceptMomentum(mom, fCurrentID)) return kTRUE;
   return GetMomentumFromParticle(mom, vp);
 }
 
@@ -270,7 +270,7 @@ AliVTrack* AliTrackContainer::GetAcceptTrack(Int_t i) const
 {
   UInt_t rejectionReason;
   if (i == -1) i = fCurrentID;
-  if (AcceptTrack(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetTrack(i);
   }
   else {
@@ -467,6 +467,7 @@ Bool_t AliTrackContainer::GetAcceptMomentum(TLorentzVector &mom, Int_t i) const
   Double_t mass = fMassHypothesis;
 
   if (i == -1) i = fCurrentID;
+  if (GetCachedAcceptMomentum(mom, i)) return kTRUE;
   AliVTrack *vp = GetAcceptTrack(i);
   if (vp) {
     if (mass < 0) mass = vp->M();
@@ -504,6 +505,7 @@ Bool_t AliTrackContainer::GetNextAcceptMomentum(TLorentzVector &mom)
 
   AliVTrack *vp = GetNextAcceptTrack();
   if (vp) {
+    if (GetCachedAcceptMomentum(mom, fCurrentID)) return kTRUE;
     if (mass < 0) mass = vp->M();
 
     if (fLoadedClass->InheritsFrom("AliESDtrack") && IsHybridTrackSelection() &&
@@ -593,6 +595,7 @@ void AliTrackContainer::AddTrackCuts(AliVCuts *cuts)
     fListOfCuts->SetOwner(true);
   }
   fListOfCuts->Add(cuts);
+  InvalidateAcceptCache();
 }
 
 /**
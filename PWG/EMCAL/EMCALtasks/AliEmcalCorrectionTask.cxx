@@ -1005,6 +1005,9 @@ AliEmcalContainer * AliEmcalCorrectionTask::AddContainer(const AliEmcalContainer
     AdoptParticleContainer(dynamic_cast<AliParticleContainer *>(cont));
   }
   cont->SetName(containerName.c_str());
+  // Correction components modify the objects in place during the event,
+  // so the acceptance must not be cached
+  cont->SetCacheAcceptance(kFALSE);
 
   return cont;
 }
@@ -31,6 +31,7 @@
 #include "AliEMCALTriggerAlgorithm.h"
 #include "AliEMCALTriggerRawPatch.h"
 #include "AliEmcalTriggerMakerKernel.h"
+#include "AliEmcalTriggerSATPatchFinder.h"
 #include "AliEmcalTriggerSetupInfo.h"
 #include "AliLog.h"
 #include "AliVCaloCells.h"
@@ -50,6 +51,9 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fTriggerBitConfig(nullptr),
   fPatchFinder(nullptr),
   fLevel0PatchFinder(nullptr),
+  fSATPatchFinder(nullptr),
+  fSATLevel0PatchFinder(nullptr),
+  fUseSATPatchFinder(kTRUE),
   fL0MinTime(7),
   fL0MaxTime(10),
   fMinCellAmp(0),
@@ -69,6 +73,8 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fScaleShift(0.),
   fDoBackgroundSubtraction(false),
   fGeometry(nullptr),
+  fBadChannelMask(),
+  fOfflineBadChannelMask(),
   fPatchAmplitudes(nullptr),
   fPatchADCSimple(nullptr),
   fPatchADC(nullptr),
@@ -93,6 +99,8 @@ AliEmcalTriggerMakerKernel::~AliEmcalTriggerMakerKernel() {
   delete fTriggerBitMap;
   delete fPatchFinder;
   delete fLevel0PatchFinder;
+  delete fSATPatchFinder;
+  delete fSATLevel0PatchFinder;
   if(fTriggerBitConfig) delete fTriggerBitConfig;
 }
 
@@ -123,6 +131,9 @@ void AliEmcalTriggerMakerKernel::Init(){
     fPatchEnergySimpleSmeared = new AliEMCALTriggerDataGrid<double>;
     fPatchEnergySimpleSmeared->Allocate(48, nrows);
   }
+
+  // Bitmaps are not streamed, build them from the bad channel lists
+  BuildBadChannelMasks();
 }
 
 void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -132,6 +143,9 @@ void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowma
   trigger->SetPatchSize(patchSize);
   trigger->SetSubregionSize(subregionSize);
   fPatchFinder->AddTriggerAlgorithm(trigger);
+
+  if (!fSATPatchFinder) fSATPatchFinder = new AliEmcalTriggerSATPatchFinder;
+  fSATPatchFinder->AddTriggerAlgorithm(rowmin, rowmax, bitmask, patchSize, subregionSize);
 }
 
 void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -140,6 +154,10 @@ void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowma
   fLevel0PatchFinder = new AliEMCALTriggerAlgorithm<double>(rowmin, rowmax, bitmask);
   fLevel0PatchFinder->SetPatchSize(patchSize);
   fLevel0PatchFinder->SetSubregionSize(subregionSize);
+
+  if (!fSATLevel0PatchFinder) fSATLevel0PatchFinder = new AliEmcalTriggerSATPatchFinder;
+  fSATLevel0PatchFinder->ClearTriggerAlgorithms();
+  fSATLevel0PatchFinder->AddTriggerAlgorithm(rowmin, rowmax, bitmask, patchSize, subregionSize);
 }
 
 void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
@@ -150,6 +168,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -168,6 +187,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -185,6 +205,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP20158x8()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -202,6 +223,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPPb2013()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -217,6 +239,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2012()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -232,6 +255,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -247,6 +271,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSATPatchFinder) fSATPatchFinder->ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   fConfigured = true;
@@ -363,7 +388,7 @@ void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
     }
 
     // exclude channel completely if it is masked as hot channel
-    if (fBadChannels.find(absId) != fBadChannels.end()){
+    if (IsFastORMasked(absId)){
       AliDebugStream(1) << "Found ADC for masked fastor " << absId << ", rejecting" << std::endl;
       continue;
     }
@@ -420,7 +445,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
     Short_t cellId = cells->GetCellNumber(iCell);
 
     // Check bad channel map
-    if (fOfflineBadChannels.find(cellId) != fOfflineBadChannels.end()) {
+    if (IsOfflineCellMasked(cellId)) {
       AliDebugStream(1) << "Cell " << cellId << " masked as bad channel, rejecting." << std::endl;
       continue;
     }
@@ -438,7 +463,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
       // Exclude FEE amplitudes from cells which are within a TRU which is masked at
       // online level. Using this the online acceptance can be applied to offline
       // patches as well.
-      if(fBadChannels.find(absId) != fBadChannels.end()){
+      if(IsFastORMasked(absId)){
         AliDebugStream(1) << "Cell " << cellId << " corresponding to masked fastor " << absId << ", rejecting." << std::endl;
         continue;
       }
@@ -464,7 +489,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
           int absFastor = -1;
           fGeometry->GetAbsFastORIndexFromPositionInEMCAL(icol, irow, absFastor);
           if(absFastor > -1) {
-            if(fBadChannels.find(absFastor) != fBadChannels.end()){
+            if(IsFastORMasked(absFastor)){
               AliDebugStream(1) << "In smearing, FastOR " << absFastor << " masked, rejecting." << std::endl;
               doChannel = false;
             }
@@ -531,7 +556,10 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
   std::vector<AliEMCALTriggerRawPatch> patches;
-  if (fPatchFinder) {
+  if (fUseSATPatchFinder && fSATPatchFinder) {
+    fSATPatchFinder->FindPatches(useL0amp ? *fPatchAmplitudes : *fPatchADC, *fPatchADCSimple, patches);
+  }
+  else if (fPatchFinder) {
     if (useL0amp) {
       patches = fPatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
     }
@@ -593,7 +621,8 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
 
   // Find Level0 patches
   std::vector<AliEMCALTriggerRawPatch> l0patches;
-  if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  if (fUseSATPatchFinder && fSATLevel0PatchFinder) fSATLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple, l0patches);
+  else if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = l0patches.begin(); patchit != l0patches.end(); ++patchit){
     Int_t offlinebits = 0, onlinebits = 0;
     if(HasPHOSOverlap(*patchit)) continue;
@@ -725,10 +754,23 @@ AliEmcalTriggerMakerKernel::ELevel0TriggerStatus_t AliEmcalTriggerMakerKernel::C
 
 void AliEmcalTriggerMakerKernel::ClearFastORBadChannels(){
   fBadChannels.clear();
+  fBadChannelMask.Clear();
 }
 
 void AliEmcalTriggerMakerKernel::ClearOfflineBadChannels() {
   fOfflineBadChannels.clear();
+  fOfflineBadChannelMask.Clear();
+}
+
+void AliEmcalTriggerMakerKernel::BuildBadChannelMasks() {
+  fBadChannelMask.Clear();
+  for(std::set<Short_t>::const_iterator it = fBadChannels.begin(); it != fBadChannels.end(); ++it) {
+    if(*it >= 0) fBadChannelMask.SetBitNumber(*it);
+  }
+  fOfflineBadChannelMask.Clear();
+  for(std::set<Short_t>::const_iterator it = fOfflineBadChannels.begin(); it != fOfflineBadChannels.end(); ++it) {
+    if(*it >= 0) fOfflineBadChannelMask.SetBitNumber(*it);
+  }
 }
 
 Bool_t AliEmcalTriggerMakerKernel::IsGammaPatch(const AliEMCALTriggerRawPatch &patch) const {
@@ -9,6 +9,7 @@
 
 #include <TObject.h>
 #include <TArrayF.h>
+#include <TBits.h>
 //#include <AliEMCALTriggerPatchInfoV1.h>
 
 class TF1;
@@ -21,6 +22,7 @@ class AliVCaloTrigger;
 class AliVEvent;
 class AliVVZERO;
 class AliEMCALTriggerBitConfig;
+class AliEmcalTriggerSATPatchFinder;
 template<class T> class AliEMCALTriggerDataGrid;
 template<class T> class AliEMCALTriggerAlgorithm;
 template<class T> class AliEMCALTriggerPatchFinder;
@@ -223,7 +225,7 @@ public:
    * @brief Add a FastOR bad channel to the list
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); }
+  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); if(absId >= 0) fBadChannelMask.SetBitNumber(absId); }
 
   /**
    * @brief Read the FastOR bad channel map from a standard stream
@@ -246,7 +248,7 @@ public:
    * @brief Add an offline bad channel to the set
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); }
+  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); if(absId >= 0) fOfflineBadChannelMask.SetBitNumber(absId); }
 
   /**
    * @brief Read the offline bad channel map from a standard stream
@@ -338,6 +340,15 @@ public:
    */
   void SetApplyOnlineBadChannelMaskingToSmeared(Bool_t doApply = kTRUE) { fApplyOnlineBadChannelsToSmeared = doApply; }
 
+  /**
+   * @brief Use the patch finder based on summed-area tables (AliEmcalTriggerSATPatchFinder)
+   *
+   * The patches found are identical to the ones from AliEMCALTriggerPatchFinder,
+   * the data grids are however read only once per event for all patch sizes.
+   * @param[in] doUse If true the summed-area table patch finder is used (default)
+   */
+  void SetUseSATPatchFinder(Bool_t doUse = kTRUE) { fUseSATPatchFinder = doUse; }
+
   /**
    * @brief Reset all data grids and VZERO-dependent L1 thresholds
    */
@@ -504,6 +515,25 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Check whether a FastOR is masked online
+   * @param[in] absId Absolute ID of the FastOR
+   * @return True if the FastOR is in the list of bad FastORs
+   */
+  Bool_t IsFastORMasked(Int_t absId) const { return absId >= 0 ? fBadChannelMask.TestBitNumber(absId) : fBadChannels.find(absId) != fBadChannels.end(); }
+
+  /**
+   * @brief Check whether a cell is masked offline
+   * @param[in] absId Absolute ID of the cell
+   * @return True if the cell is in the list of offline bad cells
+   */
+  Bool_t IsOfflineCellMasked(Int_t absId) const { return absId >= 0 ? fOfflineBadChannelMask.TestBitNumber(absId) : fOfflineBadChannels.find(absId) != fOfflineBadChannels.end(); }
+
+  /**
+   * @brief Build the bad channel bitmaps from the lists of online and offline bad channels
+   */
+  void BuildBadChannelMasks();
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -511,6 +541,9 @@ protected:
 
   AliEMCALTriggerPatchFinder<double>       *fPatchFinder;                 ///< The actual patch finder
   AliEMCALTriggerAlgorithm<double>         *fLevel0PatchFinder;           ///< Patch finder for Level0 patches
+  AliEmcalTriggerSATPatchFinder            *fSATPatchFinder;              ///< Patch finder based on summed-area tables
+  AliEmcalTriggerSATPatchFinder            *fSATLevel0PatchFinder;        ///< Patch finder based on summed-area tables for Level0 patches
+  Bool_t                                    fUseSATPatchFinder;           ///< Switch for the patch finder based on summed-area tables
   Int_t                                     fL0MinTime;                   ///< Minimum L0 time
   Int_t                                     fL0MaxTime;                   ///< Maximum L0 time
   Int_t                                     fMinCellAmp;                  ///< Minimum offline amplitude of the cells used to generate the patches
@@ -534,6 +567,8 @@ protected:
   Bool_t                                    fDoBackgroundSubtraction;     ///< Swtich for background subtraction (only online ADC)
 
   const AliEMCALGeometry                    *fGeometry;                   //!<! Underlying EMCAL geometry
+  TBits                                     fBadChannelMask;              //!<! Bitmap of bad channels (by FastOR abs ID)
+  TBits                                     fOfflineBadChannelMask;       //!<! Bitmap of offline bad channels (by cell abs ID)
   AliEMCALTriggerDataGrid<double>           *fPatchAmplitudes;            //!<! TRU Amplitudes (for L0)
   AliEMCALTriggerDataGrid<double>           *fPatchADCSimple;             //!<! patch map for simple offline trigger
   AliEMCALTriggerDataGrid<double>           *fPatchADC;                   //!<! ADC values map
@@ -545,7 +580,7 @@ protected:
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
@@ -0,0 +1,208 @@
+/**************************************************************************
+ * Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <cmath>
+#include <vector>
+
+#include "AliEMCALTriggerDataGrid.h"
+#include "AliEMCALTriggerRawPatch.h"
+#include "AliEmcalTriggerSATPatchFinder.h"
+#include "AliLog.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTriggerSATPatchFinder)
+/// \endcond
+
+AliEmcalTriggerSATPatchFinder::AliEmcalTriggerSATPatchFinder():
+  TObject(),
+  fRowMin(),
+  fRowMax(),
+  fBitMask(),
+  fPatchSize(),
+  fSubregionSize(),
+  fThreshold(),
+  fOfflineThreshold(),
+  fNCols(0),
+  fNRows(0),
+  fOnlineIntegral(kFALSE),
+  fOfflineIntegral(kFALSE),
+  fOnline(),
+  fOffline(),
+  fOccupancySAT(),
+  fOnlineSAT(),
+  fOfflineSAT(),
+  fWindowCols(),
+  fWindowOnline(),
+  fWindowOffline(),
+  fWindowSelected()
+{
+}
+
+void AliEmcalTriggerSATPatchFinder::AddTriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize, Double_t threshold, Double_t offlineThreshold){
+  if(patchSize < 1 || subregionSize < 1){
+    AliErrorStream() << "Invalid algorithm: patch size " << patchSize << ", subregion size " << subregionSize << " - not added" << std::endl;
+    return;
+  }
+  fRowMin.push_back(rowmin);
+  fRowMax.push_back(rowmax);
+  fBitMask.push_back(bitmask);
+  fPatchSize.push_back(patchSize);
+  fSubregionSize.push_back(subregionSize);
+  fThreshold.push_back(threshold);
+  fOfflineThreshold.push_back(offlineThreshold);
+}
+
+void AliEmcalTriggerSATPatchFinder::ClearTriggerAlgorithms(){
+  fRowMin.clear();
+  fRowMax.clear();
+  fBitMask.clear();
+  fPatchSize.clear();
+  fSubregionSize.clear();
+  fThreshold.clear();
+  fOfflineThreshold.clear();
+}
+
+void AliEmcalTriggerSATPatchFinder::FindPatches(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc, std::vector<AliEMCALTriggerRawPatch> &result){
+  result.clear();
+  if(adc.GetNumberOfCols() != offlineAdc.GetNumberOfCols() || adc.GetNumberOfRows() != offlineAdc.GetNumberOfRows()){
+    AliErrorStream() << "Online (" << adc.GetNumberOfCols() << "x" << adc.GetNumberOfRows() << ") and offline ("
+                     << offlineAdc.GetNumberOfCols() << "x" << offlineAdc.GetNumberOfRows() << ") grids differ in size" << std::endl;
+    return;
+  }
+  BuildTables(adc, offlineAdc);
+  for(Int_t ialgo = 0; ialgo < GetNumberOfTriggerAlgorithms(); ialgo++) RunAlgorithm(ialgo, result);
+}
+
+void AliEmcalTriggerSATPatchFinder::BuildTables(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc){
+  // Integer sums are exact in double precision below 2^53
+  const Double_t kMaxExactSum = 9007199254740992.;
+
+  fNCols = adc.GetNumberOfCols();
+  fNRows = adc.GetNumberOfRows();
+  const Int_t stride = fNCols + 1;
+  fOnline.resize(fNCols * fNRows);
+  fOffline.resize(fNCols * fNRows);
+  fOccupancySAT.assign(stride * (fNRows + 1), 0);
+  fOnlineSAT.assign(stride * (fNRows + 1), 0.);
+  fOfflineSAT.assign(stride * (fNRows + 1), 0.);
+
+  fOnlineIntegral = fOfflineIntegral = kTRUE;
+  Double_t sumAbsOnline = 0., sumAbsOffline = 0.;
+  for(Int_t irow = 0; irow < fNRows; irow++){
+    Int_t rowOccupancy = 0;
+    Double_t rowOnline = 0., rowOffline = 0.;
+    for(Int_t icol = 0; icol < fNCols; icol++){
+      Double_t online = adc(icol, irow), offline = offlineAdc(icol, irow);
+      fOnline[irow * fNCols + icol] = online;
+      fOffline[irow * fNCols + icol] = offline;
+      if(online != std::floor(online)) fOnlineIntegral = kFALSE;
+      if(offline != std::floor(offline)) fOfflineIntegral = kFALSE;
+      sumAbsOnline += std::fabs(online);
+      sumAbsOffline += std::fabs(offline);
+      if(online != 0. || offline != 0.) rowOccupancy++;
+      rowOnline += online;
+      rowOffline += offline;
+      const Int_t index = (irow + 1) * stride + icol + 1;
+      fOccupancySAT[index] = fOccupancySAT[index - stride] + rowOccupancy;
+      fOnlineSAT[index] = fOnlineSAT[index - stride] + rowOnline;
+      fOfflineSAT[index] = fOfflineSAT[index - stride] + rowOffline;
+    }
+  }
+  if(!(sumAbsOnline < kMaxExactSum)) fOnlineIntegral = kFALSE;
+  if(!(sumAbsOffline < kMaxExactSum)) fOfflineIntegral = kFALSE;
+}
+
+void AliEmcalTriggerSATPatchFinder::RunAlgorithm(Int_t ialgo, std::vector<AliEMCALTriggerRawPatch> &result){
+  const Int_t patchSize = fPatchSize[ialgo], subregionSize = fSubregionSize[ialgo];
+  const Double_t threshold = fThreshold[ialgo], offlineThreshold = fOfflineThreshold[ialgo];
+  const Int_t rowStartMax = fRowMax[ialgo] - (patchSize - 1),
+              colStartMax = fNCols - patchSize;
+
+  for(Int_t irow = fRowMin[ialgo]; irow <= rowStartMax; irow += subregionSize){
+    // Channels outside the grid do not contribute, as in AliEMCALTriggerAlgorithm
+    const Int_t row0 = irow < 0 ? 0 : irow,
+                row1 = irow + patchSize > fNRows ? fNRows : irow + patchSize;
+
+    // Select windows with at least one active channel. Sums over empty
+    // windows are 0 in both online and offline amplitude
+    fWindowCols.clear();
+    if(row0 < row1){
+      for(Int_t icol = 0; icol <= colStartMax; icol += subregionSize){
+        if(GetWindowSum(fOccupancySAT, icol, row0, icol + patchSize, row1)) fWindowCols.push_back(icol);
+      }
+    }
+    const Int_t nwindows = fWindowCols.size();
+
+    if(nwindows){
+      fWindowOnline.resize(nwindows);
+      fWindowOffline.resize(nwindows);
+      if(fOnlineIntegral){
+        for(Int_t iwin = 0; iwin < nwindows; iwin++) fWindowOnline[iwin] = GetWindowSum(fOnlineSAT, fWindowCols[iwin], row0, fWindowCols[iwin] + patchSize, row1);
+      } else {
+        SumWindowsInOrder(fOnline, row0, row1, patchSize, fWindowOnline);
+      }
+      if(fOfflineIntegral){
+        for(Int_t iwin = 0; iwin < nwindows; iwin++) fWindowOffline[iwin] = GetWindowSum(fOfflineSAT, fWindowCols[iwin], row0, fWindowCols[iwin] + patchSize, row1);
+      } else {
+        SumWindowsInOrder(fOffline, row0, row1, patchSize, fWindowOffline);
+      }
+    }
+
+    if(0. > threshold || 0. > offlineThreshold){
+      // Empty windows pass the thresholds as well: emit all windows of the row
+      // in column order, taking the sums of the occupied ones
+      Int_t iwin = 0;
+      for(Int_t icol = 0; icol <= colStartMax; icol += subregionSize){
+        Double_t online = 0., offline = 0.;
+        if(iwin < nwindows && fWindowCols[iwin] == icol){
+          online = fWindowOnline[iwin];
+          offline = fWindowOffline[iwin];
+          iwin++;
+        }
+        if(online > threshold || offline > offlineThreshold){
+          AliEMCALTriggerRawPatch recpatch(icol, irow, patchSize, online, offline);
+          recpatch.SetBitmask(fBitMask[ialgo]);
+          result.push_back(recpatch);
+        }
+      }
+      continue;
+    }
+
+    if(!nwindows) continue;
+    fWindowSelected.resize(nwindows);
+    for(Int_t iwin = 0; iwin < nwindows; iwin++) fWindowSelected[iwin] = (fWindowOnline[iwin] > threshold) | (fWindowOffline[iwin] > offlineThreshold);
+    for(Int_t iwin = 0; iwin < nwindows; iwin++){
+      if(!fWindowSelected[iwin]) continue;
+      AliEMCALTriggerRawPatch recpatch(fWindowCols[iwin], irow, patchSize, fWindowOnline[iwin], fWindowOffline[iwin]);
+      recpatch.SetBitmask(fBitMask[ialgo]);
+      result.push_back(recpatch);
+    }
+  }
+}
+
+void AliEmcalTriggerSATPatchFinder::SumWindowsInOrder(const std::vector<Double_t> &values, Int_t row0, Int_t row1, Int_t patchSize, std::vector<Double_t> &sums) const {
+  // Same summation order per window as in AliEMCALTriggerAlgorithm (rows outer,
+  // columns inner), all windows of the row advanced together
+  const Int_t nwindows = fWindowCols.size();
+  const Int_t *cols = &fWindowCols[0];
+  Double_t *windowsums = &sums[0];
+  for(Int_t iwin = 0; iwin < nwindows; iwin++) windowsums[iwin] = 0.;
+  for(Int_t jrow = row0; jrow < row1; jrow++){
+    const Double_t *rowvalues = &values[jrow * fNCols];
+    for(Int_t jcol = 0; jcol < patchSize; jcol++){
+      const Double_t *colvalues = rowvalues + jcol;
+      for(Int_t iwin = 0; iwin < nwindows; iwin++) windowsums[iwin] += colvalues[cols[iwin]];
+    }
+  }
+}
@@ -0,0 +1,149 @@
+#ifndef ALIEMCALTRIGGERSATPATCHFINDER_H
+#define ALIEMCALTRIGGERSATPATCHFINDER_H
+/* Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliEMCALTriggerRawPatch;
+template<class T> class AliEMCALTriggerDataGrid;
+
+/**
+ * @class AliEmcalTriggerSATPatchFinder
+ * @brief Trigger patch finder based on summed-area tables
+ * @ingroup EMCALTRGFW
+ *
+ * Finds the same patches as AliEMCALTriggerPatchFinder with the same
+ * list of AliEMCALTriggerAlgorithm, but reads each data grid only once
+ * per event for all algorithms (patch sizes) and for both online and
+ * offline amplitudes:
+ * - Integral image of the channel occupancy (channels with non-zero online
+ *   or offline amplitude). Windows without any active channel are rejected
+ *   without summing.
+ * - Integral image of the online and offline amplitudes. It is used
+ *   for a grid only when all amplitudes of the grid are integer (L1 ADC
+ *   counts), for which the sum over the window is exact.
+ * - For non-integer grids (offline ADC, L0 amplitudes) the window sums of the
+ *   occupied windows are calculated in the same order as in AliEMCALTriggerAlgorithm,
+ *   for all windows in a row at once.
+ * In both cases the patch amplitudes are bit-identical to the ones obtained
+ * with AliEMCALTriggerPatchFinder. The threshold selection is done for all
+ * windows in a row at once, on the flat arrays of window sums.
+ */
+class AliEmcalTriggerSATPatchFinder : public TObject {
+public:
+
+  /**
+   * @brief Constructor
+   */
+  AliEmcalTriggerSATPatchFinder();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalTriggerSATPatchFinder() {}
+
+  /**
+   * @brief Add a trigger algorithm (same parameters as AliEMCALTriggerAlgorithm)
+   * @param[in] rowmin Minimum row value
+   * @param[in] rowmax Maximum row value
+   * @param[in] bitmask Offline bit mask to be applied to the patches
+   * @param[in] patchSize Size of the patches
+   * @param[in] subregionSize Size of the sliding sub region
+   * @param[in] threshold Threshold on the online patch amplitude
+   * @param[in] offlineThreshold Threshold on the offline patch amplitude
+   */
+  void AddTriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize, Double_t threshold = 0., Double_t offlineThreshold = 0.);
+
+  /**
+   * @brief Remove all trigger algorithms
+   */
+  void ClearTriggerAlgorithms();
+
+  /**
+   * @brief Get the number of trigger algorithms
+   * @return Number of trigger algorithms
+   */
+  Int_t GetNumberOfTriggerAlgorithms() const { return fRowMin.size(); }
+
+  /**
+   * @brief Run all trigger algorithms on the data grids
+   *
+   * Patches are ordered by algorithm (in the order they were added), then by
+   * row and column of the patch start, as in AliEMCALTriggerPatchFinder.
+   * @param[in] adc Grid with online amplitudes
+   * @param[in] offlineAdc Grid with offline amplitudes (same dimensions as adc)
+   * @param[out] result Patches found by all algorithms
+   */
+  void FindPatches(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc, std::vector<AliEMCALTriggerRawPatch> &result);
+
+protected:
+  /**
+   * @brief Build the flat copies and integral images of the data grids
+   * @param[in] adc Grid with online amplitudes
+   * @param[in] offlineAdc Grid with offline amplitudes
+   */
+  void BuildTables(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc);
+
+  /**
+   * @brief Run one trigger algorithm on the tables built for the event
+   * @param[in] ialgo Index of the algorithm
+   * @param[out] result Container the patches are appended to
+   */
+  void RunAlgorithm(Int_t ialgo, std::vector<AliEMCALTriggerRawPatch> &result);
+
+  /**
+   * @brief Sum of an integral image over a window
+   * @param[in] table Integral image, (fNCols+1) x (fNRows+1) entries
+   * @param[in] col0 First column
+   * @param[in] row0 First row
+   * @param[in] col1 Last column + 1
+   * @param[in] row1 Last row + 1
+   * @return Sum over the window
+   */
+  template<typename T>
+  T GetWindowSum(const std::vector<T> &table, Int_t col0, Int_t row0, Int_t col1, Int_t row1) const {
+    const Int_t stride = fNCols + 1;
+    return table[row1 * stride + col1] - table[row0 * stride + col1] - table[row1 * stride + col0] + table[row0 * stride + col0];
+  }
+
+  /**
+   * @brief Sum the amplitudes of the occupied windows of a row in the order of AliEMCALTriggerAlgorithm
+   * @param[in] values Flat grid (row-major)
+   * @param[in] row0 First row of the windows
+   * @param[in] row1 Last row + 1 of the windows
+   * @param[in] patchSize Size of the windows
+   * @param[out] sums Window sums, one per entry in fWindowCols
+   */
+  void SumWindowsInOrder(const std::vector<Double_t> &values, Int_t row0, Int_t row1, Int_t patchSize, std::vector<Double_t> &sums) const;
+
+  std::vector<Int_t>              fRowMin;                ///< Minimum row of each algorithm
+  std::vector<Int_t>              fRowMax;                ///< Maximum row of each algorithm
+  std::vector<UInt_t>             fBitMask;               ///< Bit mask of each algorithm
+  std::vector<Int_t>              fPatchSize;             ///< Patch size of each algorithm
+  std::vector<Int_t>              fSubregionSize;         ///< Sliding sub region size of each algorithm
+  std::vector<Double_t>           fThreshold;             ///< Online threshold of each algorithm
+  std::vector<Double_t>           fOfflineThreshold;      ///< Offline threshold of each algorithm
+
+  Int_t                           fNCols;                 //!<! Number of columns of the grids of the event
+  Int_t                           fNRows;                 //!<! Number of rows of the grids of the event
+  Bool_t                          fOnlineIntegral;        //!<! All online amplitudes are integer, sums from integral image are exact
+  Bool_t                          fOfflineIntegral;       //!<! All offline amplitudes are integer, sums from integral image are exact
+  std::vector<Double_t>           fOnline;                //!<! Flat copy of the online amplitudes (row-major)
+  std::vector<Double_t>           fOffline;               //!<! Flat copy of the offline amplitudes (row-major)
+  std::vector<Int_t>              fOccupancySAT;          //!<! Integral image of the number of active channels
+  std::vector<Double_t>           fOnlineSAT;             //!<! Integral image of the online amplitudes
+  std::vector<Double_t>           fOfflineSAT;            //!<! Integral image of the offline amplitudes
+  std::vector<Int_t>              fWindowCols;            //!<! Start columns of the occupied windows in a row
+  std::vector<Double_t>           fWindowOnline;          //!<! Online sums of the occupied windows in a row
+  std::vector<Double_t>           fWindowOffline;         //!<! Offline sums of the occupied windows in a row
+  std::vector<UChar_t>            fWindowSelected;        //!<! Threshold decision of the occupied windows in a row
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTriggerSATPatchFinder, 1);
+  /// \endcond
+};
+
+#endif
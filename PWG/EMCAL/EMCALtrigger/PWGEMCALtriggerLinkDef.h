@@ -7,6 +7,7 @@
 #pragma link C++ class AliEmcalTriggerMaker+;
 #pragma link C++ class AliEmcalTriggerMakerKernel+;
 #pragma link C++ class AliEmcalTriggerMakerTask+;
+#pragma link C++ class AliEmcalTriggerSATPatchFinder+;
 #pragma link C++ class AliEmcalTriggerSetupInfo+;
 #pragma link C++ class AliEmcalTriggerQATask+;
 #pragma link C++ class AliEmcalTriggerSimQATask+;
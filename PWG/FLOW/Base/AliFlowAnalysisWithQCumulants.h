@@ -15,6 +15,7 @@
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
 #include "TMatrixD.h"
+#include "TArrayD.h"
 #include "TH2D.h"
 #include "TRandom3.h"
 #include "AliFlowCommonConstants.h"
@@ -78,6 +79,7 @@ class AliFlowAnalysisWithQCumulants{
   virtual void Make(AliFlowEventSimple *anEvent);
     // 2a.) Common:
     virtual void CheckPointersUsedInMake();     
+    virtual void AccumulateQvectors(Int_t nRPs);
     virtual void FillAverageMultiplicities(Int_t nRP);
     virtual void FillCommonControlHistograms(AliFlowEventSimple *anEvent);
     virtual void FillControlHistograms(AliFlowEventSimple *anEvent);
@@ -287,6 +289,8 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t GetFillProfilesVsMUsingWeights() const {return this->fFillProfilesVsMUsingWeights;};
   void SetUseQvectorTerms(Bool_t const uqvt){this->fUseQvectorTerms = uqvt;if(uqvt){this->fStoreControlHistograms = kTRUE;}};
   Bool_t GetUseQvectorTerms() const {return this->fUseQvectorTerms;};
+  void SetUseQvectorRecurrence(Bool_t const uqvr){this->fUseQvectorRecurrence = uqvr;};
+  Bool_t GetUseQvectorRecurrence() const {return this->fUseQvectorRecurrence;};
 
   // Reference flow profiles:
   void SetAvMultiplicity(TProfile* const avMultiplicity) {this->fAvMultiplicity = avMultiplicity;};
@@ -627,6 +631,8 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fUse2DHistograms; // use TH2D instead of TProfile to improve numerical stability in reference flow calculation 
   Bool_t fFillProfilesVsMUsingWeights; // if the width of multiplicity bin is 1, weights are not needed  
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation 
+  Bool_t fUseQvectorRecurrence; // calculate Q_{m*n,k} and S_{p,k} for all RPs at once in AccumulateQvectors() (kTRUE by default)
+  TArrayD fQvectorBuffer[2]; //! [0=phi,1=weight] of RPs in current event, used by AccumulateQvectors()
 
   //  3c.) event-by-event quantities:
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
@@ -847,7 +853,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 5);
 
 };
 
@@ -32,6 +32,10 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <TRandom3.h>
+
+#include <algorithm>
+#include <thread>
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -172,7 +176,17 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fNThreads(0),
+  fSeed(0),
+  fRandom(0),
+  fSigFlucCdf(),
+  fXA(),
+  fYA(),
+  fSigA(),
+  fCellStart(),
+  fCellNucleons(),
+  fHits()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +336,17 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fNThreads(in.fNThreads),
+  fSeed(in.fSeed),
+  fRandom(0),
+  fSigFlucCdf(in.fSigFlucCdf),
+  fXA(),
+  fYA(),
+  fSigA(),
+  fCellStart(),
+  fCellNucleons(),
+  fHits()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -453,21 +477,57 @@ AliGlauberMC& AliGlauberMC::operator=(const AliGlauberMC& in)
   fSxyCom=in.fSxyCom;
   fX=in.fX;
   fNpp=in.fNpp;
+  fNThreads=in.fNThreads;
+  fSeed=in.fSeed;
   return *this;
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::SetRandom(TRandom *rnd)
+{
+  // use rnd instead of gRandom, also for the nuclei
+  fRandom = rnd;
+  fANucleus.SetRandom(rnd);
+  fBNucleus.SetRandom(rnd);
+  if (fRandom && fSigFluc && fSigFlucCdf.empty())
+    AliGlauberNucleus::TabulateFunction(fSigFluc, fSigFlucCdf);
+}
+
+//______________________________________________________________________________
+TRandom *AliGlauberMC::GetRandom() const
+{
+  // random generator of this instance
+  return fRandom ? fRandom : gRandom;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::InitSigFluc()
+{
+  // parameterization for fluctuating sigNN
+  fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
+  fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
+  fSigFlucCdf.clear();
+  cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberMC::GetRandomSigNN()
+{
+  // fluctuating sigNN
+  if (!fRandom)
+    return fSigFluc->GetRandom();
+  if (fSigFlucCdf.empty())
+    AliGlauberNucleus::TabulateFunction(fSigFluc, fSigFlucCdf);
+  return AliGlauberNucleus::GetRandomFromTable(fSigFluc, fSigFlucCdf, fRandom);
+}
+
 //______________________________________________________________________________
 Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
 {
   // prepare event
 
-  if (fDoFluc) {
-    if (!fSigFluc) {
-      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
-      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
-      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
-    }
-  }
+  if (fDoFluc && !fSigFluc)
+    InitSigFluc();
 
   fANucleus.ThrowNucleons(-bgen/2.);
   fNucleonsA = fANucleus.GetNucleons();
@@ -480,7 +540,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonA->SetInNucleusA();
     nucleonA->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonA->SetSigNN(fSigFluc->GetRandom());
+      nucleonA->SetSigNN(GetRandomSigNN());
   }
   fBNucleus.ThrowNucleons(bgen/2.);
   fNucleonsB = fBNucleus.GetNucleons();
@@ -493,7 +553,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonB->SetInNucleusB();
     nucleonB->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonB->SetSigNN(fSigFluc->GetRandom());
+      nucleonB->SetSigNN(GetRandomSigNN());
   }
 
   if (fDoFluc) {
@@ -502,7 +562,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
       fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
       cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
     }
-    fXSect = fSigFluc->GetRandom();
+    fXSect = GetRandomSigNN();
   }
   // "ball" diameter = distance at which two balls interact
   Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
@@ -511,33 +571,111 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
+  // Flat copy of the transverse positions of nucleus A, sorted into a grid with
+  // cells not smaller than the largest interaction distance: the nucleons of A
+  // colliding with a nucleon of B are in its cell or in the adjacent ones.
+  const Int_t kMaxCells = 256; // per direction
+  Double_t d2Max = d2;
+  Double_t xMin = 0, xMax = 0, yMin = 0, yMax = 0;
+  fXA.resize(fAN);
+  fYA.resize(fAN);
+  fSigA.resize(fAN);
+  for (Int_t j = 0; j<fAN; j++)
+  {
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+    fXA[j] = nucleonA->GetX();
+    fYA[j] = nucleonA->GetY();
+    fSigA[j] = nucleonA->GetSigNN();
+    if (j==0 || fXA[j]<xMin) xMin = fXA[j];
+    if (j==0 || fXA[j]>xMax) xMax = fXA[j];
+    if (j==0 || fYA[j]<yMin) yMin = fYA[j];
+    if (j==0 || fYA[j]>yMax) yMax = fYA[j];
+    if (fDoFluc)
+      d2Max = TMath::Max(d2Max, fSigA[j]/(TMath::Pi()*10));
+  }
+  if (fDoFluc) {
+    for (Int_t i = 0; i<fBN; i++)
+      d2Max = TMath::Max(d2Max, ((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i)))->GetSigNN()/(TMath::Pi()*10));
+  }
+
+  Double_t cell = TMath::Sqrt(TMath::Max(d2Max,0.));
+  Int_t nx = 0;
+  Int_t ny = 0;
+  if (fAN>0 && cell>0) {
+    cell = TMath::Max(cell, TMath::Max(xMax-xMin,yMax-yMin)/kMaxCells);
+    nx = TMath::Min(Int_t((xMax-xMin)/cell)+1, kMaxCells+1);
+    ny = TMath::Min(Int_t((yMax-yMin)/cell)+1, kMaxCells+1);
+    // counting sort: fCellStart[c] is the first entry of cell c in fCellNucleons,
+    // with the nucleons of each cell in increasing order
+    fCellStart.assign(nx*ny+1, 0);
+    for (Int_t j = 0; j<fAN; j++) {
+      Int_t cx = TMath::Min(Int_t((fXA[j]-xMin)/cell), nx-1);
+      Int_t cy = TMath::Min(Int_t((fYA[j]-yMin)/cell), ny-1);
+      fCellStart[cx+nx*cy]++;
+    }
+    for (Int_t c = 1; c<=nx*ny; c++)
+      fCellStart[c] += fCellStart[c-1];
+    fCellNucleons.resize(fAN);
+    for (Int_t j = fAN-1; j>=0; j--) {
+      Int_t cx = TMath::Min(Int_t((fXA[j]-xMin)/cell), nx-1);
+      Int_t cy = TMath::Min(Int_t((fYA[j]-yMin)/cell), ny-1);
+      fCellNucleons[--fCellStart[cx+nx*cy]] = j;
+    }
+  }
+
   // for each of the A nucleons in nucleus B
-  for (Int_t i = 0; i<fBN; i++)
+  for (Int_t i = 0; i<fBN && nx>0; i++)
   {
     AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-    for (Int_t j = 0 ; j < fAN ; j++)
+    Double_t xB = nucleonB->GetX();
+    Double_t yB = nucleonB->GetY();
+    Double_t sigB = nucleonB->GetSigNN();
+    Int_t ix = TMath::FloorNint((xB-xMin)/cell);
+    Int_t iy = TMath::FloorNint((yB-yMin)/cell);
+    fHits.clear();
+    for (Int_t cy = TMath::Max(iy-1,0); cy <= TMath::Min(iy+1,ny-1); cy++)
+    {
+      for (Int_t cx = TMath::Max(ix-1,0); cx <= TMath::Min(ix+1,nx-1); cx++)
+      {
+        Int_t c = cx+nx*cy;
+        for (Int_t k = fCellStart[c]; k<fCellStart[c+1]; k++)
+        {
+          Int_t j = fCellNucleons[k];
+          Double_t dx = xB-fXA[j];
+          Double_t dy = yB-fYA[j];
+          Double_t dij = dx*dx+dy*dy;
+          if (fDoFluc)
+            d2 = TMath::Max(fSigA[j],sigB)/(TMath::Pi()*10); // in fm^2
+          if (dij < d2)
+            fHits.push_back(j);
+        }
+      }
+    }
+    // same order as a loop over all nucleons of A, for identical sums
+    std::sort(fHits.begin(), fHits.end());
+    for (UInt_t h = 0; h<fHits.size(); h++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
+      Int_t j = fHits[h];
+      Double_t dx = xB-fXA[j];
+      Double_t dy = yB-fYA[j];
       Double_t dij = dx*dx+dy*dy;
       if (fDoFluc) {
 	//fXSect = nucleonA->GetSigNN();
 	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
-	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
-      }
-      if (dij < d2)
-      {
-	bNN += dij;
-	++Nco;
-        nucleonB->Collide();
-        nucleonA->Collide();
-	if (dij<d2/4)
-	  ++Ncohc;
+	d2 = TMath::Max(fSigA[j],sigB)/(TMath::Pi()*10); // in fm^2
       }
+      bNN += dij;
+      ++Nco;
+      nucleonB->Collide();
+      ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j)))->Collide();
+      if (dij<d2/4)
+        ++Ncohc;
     }
   }
+  if (fDoFluc && fAN>0 && fBN>0) {
+    // sigNN of the last pair, as left in fXSect by the loop over all pairs
+    fXSect = TMath::Max(fSigA[fAN-1],((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(fBN-1)))->GetSigNN());
+  }
 
   if (Nco>0) {
     fNcollw = Ncohc;
@@ -1267,7 +1405,7 @@ Int_t AliGlauberMC::NegativeBinomialRandom(Int_t k, Double_t nmean) const
   {
     array[i] = NegativeBinomialDistribution(i,k,nmean) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 
 }
@@ -1278,7 +1416,7 @@ Int_t AliGlauberMC::NegativeBinomialRandomSV(Double_t k, Double_t nbar) const
   // negative binomial distribution generator, S. Voloshin, 09-May-2007
   Double_t sum=0.;
   Int_t i=0;
-  Double_t ran=gRandom->Rndm();
+  Double_t ran=GetRandom()->Rndm();
   Double_t trm=1./pow(1.+nbar/k,k);
   if (trm==0.)
   {
@@ -1308,7 +1446,7 @@ Int_t AliGlauberMC::DoubleNegativeBinomialRandom( Int_t k,
   {
     array[i] = alpha*NegativeBinomialDistribution(i,k,nmean)+(1-alpha)*NegativeBinomialDistribution(i,k2,nmean2) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 }
 
@@ -1506,7 +1644,7 @@ Bool_t AliGlauberMC::NextEvent(Double_t bgen)
   {
     if(bgen<0||!succes) //get impactparameter
     {
-      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*gRandom->Rndm()+fBMin*fBMin);
+      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandom()->Rndm()+fBMin*fBMin);
     }
     if ( (succes=CalcEvent(bgen)) ) break; //ends if we have particparts
   }
@@ -1694,6 +1832,11 @@ void AliGlauberMC::Run(Int_t nevents)
                       "Npart:Ncoll:B:MeanX:MeanY:MeanX2:MeanY2:MeanXY:VarX:VarY:VarXY:MeanXSystem:MeanYSystem:MeanXA:MeanYA:MeanXB:MeanYB:VarE:Stoa:VarEColl:VarECom:VarEPart:VarEPartColl:VarEPartCom:dNdEta:dNdEtaGBW:dNdEtaTwoNBD:xsect:tAA:Epsl2:Epsl3:Epsl4:Epsl5:E2Coll:E3Coll:E4Coll:E5Coll:E2Com:E3Com:E4Com:E5Com:Psi2:Psi3:Psi4:Psi5:BNN:signn:Ncollw");
     fnt->SetDirectory(0);
   }
+  if (fNThreads>0)
+  {
+    RunParallel(nevents);
+    return;
+  }
   Int_t q = 0;
   Int_t u = 0;
   for (Int_t i = 0; i<nevents; i++)
@@ -1707,67 +1850,7 @@ void AliGlauberMC::Run(Int_t nevents)
 
     q++;
     Float_t v[48];
-    v[0]  = GetNpart();
-    v[1]  = GetNcoll();
-    v[2]  = fBMC;
-    v[3]  = fMeanXParts;
-    v[4]  = fMeanYParts;
-    v[5]  = fMeanX2Parts;
-    v[6]  = fMeanY2Parts;
-    v[7]  = fMeanXYParts;
-    v[8]  = fSx2Parts;
-    v[9]  = fSy2Parts;
-    v[10] = fSxyParts;
-    v[11] = fMeanXSystem;
-    v[12] = fMeanYSystem;
-    v[13] = fMeanXA;
-    v[14] = fMeanYA;
-    v[15] = fMeanXB;
-    v[16] = fMeanYB;
-    v[17] = GetEccentricity();
-    v[18] = GetStoa();
-    v[19] = GetEccentricityColl();
-    v[20] = GetEccentricityCom();
-    v[21] = GetEccentricityPart();
-    v[22] = GetEccentricityPartColl();
-    v[23] = GetEccentricityPartCom();
-    if (fDoPartProd)
-    {
-      v[24] = GetdNdEta();
-      v[25] = GetdNdEta();
-      v[26] = v[24]+v[25];
-    }
-    else
-    {
-      v[24] = 0;
-      v[25] = 0;
-      v[26] = 0;
-    }
-    v[27]=fXSect;
-
-    Float_t mytAA=-999;
-    if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
-    v[28]=mytAA;
-    //_____________epsilon2,3,4,4_______
-    v[29] = GetEpsilon2Part();
-    v[30] = GetEpsilon3Part();
-    v[31] = GetEpsilon4Part();
-    v[32] = GetEpsilon5Part();
-    v[33] = GetEpsilon2Coll();
-    v[34] = GetEpsilon3Coll();
-    v[35] = GetEpsilon4Coll();
-    v[36] = GetEpsilon5Coll();
-    v[37] = GetEpsilon2Com();
-    v[38] = GetEpsilon3Com();
-    v[39] = GetEpsilon4Com();
-    v[40] = GetEpsilon5Com();
-    v[41] = GetPsi2();
-    v[42] = GetPsi3();
-    v[43] = GetPsi4();
-    v[44] = GetPsi5();
-    v[45] = fBNN;
-    v[46] = fXSect;
-    v[47] = fNcollw;
+    FillNtupleRow(v);
 
     //always at the end
     fnt->Fill(v);
@@ -1777,6 +1860,159 @@ void AliGlauberMC::Run(Int_t nevents)
   std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::FillNtupleRow(Float_t *v)
+{
+  // values of the current event for the ntuple
+  v[0]  = GetNpart();
+  v[1]  = GetNcoll();
+  v[2]  = fBMC;
+  v[3]  = fMeanXParts;
+  v[4]  = fMeanYParts;
+  v[5]  = fMeanX2Parts;
+  v[6]  = fMeanY2Parts;
+  v[7]  = fMeanXYParts;
+  v[8]  = fSx2Parts;
+  v[9]  = fSy2Parts;
+  v[10] = fSxyParts;
+  v[11] = fMeanXSystem;
+  v[12] = fMeanYSystem;
+  v[13] = fMeanXA;
+  v[14] = fMeanYA;
+  v[15] = fMeanXB;
+  v[16] = fMeanYB;
+  v[17] = GetEccentricity();
+  v[18] = GetStoa();
+  v[19] = GetEccentricityColl();
+  v[20] = GetEccentricityCom();
+  v[21] = GetEccentricityPart();
+  v[22] = GetEccentricityPartColl();
+  v[23] = GetEccentricityPartCom();
+  if (fDoPartProd)
+  {
+    v[24] = GetdNdEta();
+    v[25] = GetdNdEta();
+    v[26] = v[24]+v[25];
+  }
+  else
+  {
+    v[24] = 0;
+    v[25] = 0;
+    v[26] = 0;
+  }
+  v[27]=fXSect;
+
+  Float_t mytAA=-999;
+  if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
+  v[28]=mytAA;
+  //_____________epsilon2,3,4,4_______
+  v[29] = GetEpsilon2Part();
+  v[30] = GetEpsilon3Part();
+  v[31] = GetEpsilon4Part();
+  v[32] = GetEpsilon5Part();
+  v[33] = GetEpsilon2Coll();
+  v[34] = GetEpsilon3Coll();
+  v[35] = GetEpsilon4Coll();
+  v[36] = GetEpsilon5Coll();
+  v[37] = GetEpsilon2Com();
+  v[38] = GetEpsilon3Com();
+  v[39] = GetEpsilon4Com();
+  v[40] = GetEpsilon5Com();
+  v[41] = GetPsi2();
+  v[42] = GetPsi3();
+  v[43] = GetPsi4();
+  v[44] = GetPsi5();
+  v[45] = fBNN;
+  v[46] = fXSect;
+  v[47] = fNcollw;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::RunParallel(Int_t nevents)
+{
+  // Run with fNThreads copies of this object. The events are generated in chunks
+  // of kChunk events, each chunk with its own TRandom3 seeded from fSeed and the
+  // chunk number, and the chunks are filled into the ntuple in order: for a given
+  // seed the ntuple does not depend on the number of threads. The random numbers
+  // are not those of the serial Run. The state of the last event (GetNpart(),
+  // GetNucleons(), ...) is not kept in this object.
+
+  const Int_t kChunk = 1000;
+  const Int_t kNVars = 48;
+  Int_t nThreads = fNThreads;
+  UInt_t seed = fSeed ? fSeed : gRandom->Integer(kMaxInt);
+  cout << "Using " << nThreads << " threads, seed " << seed << endl;
+
+  // set up the workers: the copies have their own nuclei and random generators
+  if (fDoFluc && !fSigFluc)
+    InitSigFluc();
+  std::vector<AliGlauberMC*> workers(nThreads);
+  std::vector<TRandom3*> randoms(nThreads);
+  for (Int_t t = 0; t<nThreads; t++)
+  {
+    workers[t] = new AliGlauberMC(*this);
+    workers[t]->fnt = 0;
+    workers[t]->fEvents = 0;
+    workers[t]->fTotalEvents = 0;
+    workers[t]->fMaxNpartFound = 0;
+    randoms[t] = new TRandom3(1);
+    workers[t]->SetRandom(randoms[t]);
+    // allocate the nucleons here rather than in the threads
+    workers[t]->fANucleus.ThrowNucleons();
+    workers[t]->fBNucleus.ThrowNucleons();
+  }
+
+  std::vector<std::vector<Float_t> > rows(nThreads);
+  std::vector<Int_t> nGood(nThreads);
+  Int_t nChunks = (nevents+kChunk-1)/kChunk;
+  Int_t q = 0;
+  Int_t u = 0;
+  for (Int_t first = 0; first<nChunks; first += nThreads)
+  {
+    // one chunk per thread, then fill in chunk order
+    Int_t nRound = TMath::Min(nThreads, nChunks-first);
+    std::vector<std::thread> threads;
+    for (Int_t t = 0; t<nRound; t++)
+    {
+      threads.push_back(std::thread([&, t]() {
+        Int_t chunk = first+t;
+        Int_t nEv = TMath::Min(kChunk, nevents-chunk*kChunk);
+        // decorrelate the chunks of different seeds, 0 would be a random seed
+        UInt_t chunkSeed = seed ^ (0x9e3779b9u*UInt_t(chunk+1));
+        randoms[t]->SetSeed(chunkSeed ? chunkSeed : 1);
+        rows[t].resize(nEv*kNVars);
+        nGood[t] = 0;
+        for (Int_t i = 0; i<nEv; i++)
+        {
+          if (!workers[t]->NextEvent()) continue;
+          workers[t]->FillNtupleRow(&rows[t][nGood[t]*kNVars]);
+          nGood[t]++;
+        }
+      }));
+    }
+    for (UInt_t t = 0; t<threads.size(); t++) threads[t].join();
+
+    for (Int_t t = 0; t<nRound; t++)
+    {
+      for (Int_t i = 0; i<nGood[t]; i++)
+        fnt->Fill(&rows[t][i*kNVars]);
+      q += nGood[t];
+      u += TMath::Min(kChunk, nevents-(first+t)*kChunk)-nGood[t];
+    }
+    std::cout << "Generating Event # " << TMath::Min(nevents, (first+nRound)*kChunk) << "... \r" << flush;
+  }
+
+  for (Int_t t = 0; t<nThreads; t++)
+  {
+    fEvents += workers[t]->fEvents;
+    fTotalEvents += workers[t]->fTotalEvents;
+    fMaxNpartFound = TMath::Max(fMaxNpartFound, workers[t]->fMaxNpartFound);
+    delete workers[t];
+    delete randoms[t];
+  }
+  std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
+}
+
 //---------------------------------------------------------------------------------
 void AliGlauberMC::RunAndSaveNtuple( Int_t n,
                                      const Option_t *sysA,
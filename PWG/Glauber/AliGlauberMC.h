@@ -16,9 +16,11 @@
 #include "AliGlauberNucleus.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <vector>
 
 class TObjArray;
 class TNtuple;
+class TRandom;
 
 using std::cout;
 using std::endl;
@@ -100,6 +102,9 @@ public:
    void   Seta(Double_t a)  {fANucleus.SetA(a); fBNucleus.SetA(a);}
    void   SetDoFluc(Double_t omega, Double_t sig0, Double_t lam, Bool_t on=kTRUE) 
             {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;}
+   void   SetNThreads(Int_t n)        {fNThreads = n;}
+   void   SetSeed(UInt_t seed)        {fSeed = seed;}
+   void   SetRandom(TRandom *rnd);
    static void       PrintVersion()         {cout << "AliGlauberMC " << Version() << endl;}
    static const char *Version()             {return "v1.2";}
    static void       RunAndSaveNtuple( Int_t n,
@@ -251,9 +256,24 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   Int_t        fNThreads;       //=0 serial Run with gRandom, >0 number of threads of Run (see RunParallel)
+   UInt_t       fSeed;           //seed of the random streams of RunParallel (0: taken from gRandom)
+   TRandom     *fRandom;         //!random generator, gRandom if not set
+   std::vector<Double_t> fSigFlucCdf;   //!table of fSigFluc, used with fRandom
+   std::vector<Double_t> fXA;           //!x of nucleons in nucleus A
+   std::vector<Double_t> fYA;           //!y of nucleons in nucleus A
+   std::vector<Double_t> fSigA;         //!sigNN of nucleons in nucleus A
+   std::vector<Int_t>    fCellStart;    //!first entry of each transverse grid cell in fCellNucleons
+   std::vector<Int_t>    fCellNucleons; //!nucleons of nucleus A ordered by grid cell
+   std::vector<Int_t>    fHits;         //!nucleons of nucleus A hit by the current nucleon of B
    Bool_t       CalcResults(Double_t bgen);
+   void         InitSigFluc();
+   Double_t     GetRandomSigNN();
+   TRandom     *GetRandom() const;
+   void         FillNtupleRow(Float_t *v);
+   void         RunParallel(Int_t nevents);
 
-   ClassDef(AliGlauberMC,4)
+   ClassDef(AliGlauberMC,5)
 };
 
 #endif
@@ -49,7 +49,9 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fRandom(NULL),
+  fCdf()
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -76,12 +78,18 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fMinDist(in.fMinDist),
   fF(in.fF),
   fTrials(in.fTrials),
-  fFunction(in.fFunction),
-  fNucleons(NULL)
+  fFunction(NULL),
+  fNucleons(NULL),
+  fRandom(NULL),
+  fCdf(in.fCdf)
 {
-  //copy ctor
-  if (in.fNucleons)
+  //copy ctor, the function is cloned since it is deleted with the nucleus
+  if (in.fFunction)
+    fFunction=static_cast<TF1*>((in.fFunction)->Clone());
+  if (in.fNucleons) {
     fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
+    fNucleons->SetOwner();
+  }
 }
 
 //______________________________________________________________________________
@@ -96,7 +104,10 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
   fMinDist=in.fMinDist;
   fF=in.fF;
   fTrials=in.fTrials;
-  fFunction=in.fFunction;
+  delete fFunction;
+  fFunction=in.fFunction ? static_cast<TF1*>((in.fFunction)->Clone()) : NULL;
+  fRandom=NULL;
+  fCdf=in.fCdf;
   delete fNucleons;
   fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
   fNucleons->SetOwner();
@@ -177,6 +188,7 @@ void AliGlauberNucleus::Lookup(Option_t* name)
 void AliGlauberNucleus::SetR(Double_t ir)
 {
    fR = ir;
+   fCdf.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -195,6 +207,7 @@ void AliGlauberNucleus::SetR(Double_t ir)
 void AliGlauberNucleus::SetA(Double_t ia)
 {
    fA = ia;
+   fCdf.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -212,6 +225,7 @@ void AliGlauberNucleus::SetA(Double_t ia)
 void AliGlauberNucleus::SetW(Double_t iw)
 {
    fW = iw;
+   fCdf.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -225,6 +239,59 @@ void AliGlauberNucleus::SetW(Double_t iw)
    }
 }
 
+//______________________________________________________________________________
+void AliGlauberNucleus::SetRandom(TRandom *rnd)
+{
+   // Use rnd instead of gRandom. The radius is then sampled from a table of
+   // the cumulative integral of fFunction, which is filled here, so that
+   // ThrowNucleons does not call TF1::GetRandom (which uses gRandom).
+   fRandom = rnd;
+   if (fRandom && fCdf.empty() && fFunction)
+      TabulateFunction(fFunction, fCdf);
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::GetRandomR()
+{
+   // radius distributed according to fFunction
+   if (!fRandom)
+      return fFunction->GetRandom();
+   if (fCdf.empty())
+      TabulateFunction(fFunction, fCdf);
+   return GetRandomFromTable(fFunction, fCdf, fRandom);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::TabulateFunction(TF1 *f, std::vector<Double_t> &cdf)
+{
+   // cumulative integral of f in its range, midpoint rule on fine bins
+   const Int_t nBins = 10000;
+   Double_t xmin = f->GetXmin();
+   Double_t dx = (f->GetXmax()-xmin)/nBins;
+   cdf.resize(nBins+1);
+   cdf[0] = 0;
+   for (Int_t i = 0; i<nBins; i++) {
+      Double_t val = f->Eval(xmin + (i+0.5)*dx);
+      cdf[i+1] = cdf[i] + (val>0 ? val*dx : 0.);
+   }
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::GetRandomFromTable(const TF1 *f, const std::vector<Double_t> &cdf, TRandom *rnd)
+{
+   // random number distributed according to f, using the table filled by TabulateFunction
+   // (inverse of the cumulative integral, linear within a bin)
+   Int_t nBins = cdf.size()-1;
+   Double_t u = rnd->Rndm()*cdf[nBins];
+   Int_t bin = TMath::BinarySearch(nBins+1, &cdf[0], u);
+   if (bin<0) bin = 0;
+   if (bin>=nBins) bin = nBins-1;
+   Double_t width = cdf[bin+1]-cdf[bin];
+   Double_t frac = width>0 ? (u-cdf[bin])/width : 0.5;
+   Double_t dx = (f->GetXmax()-f->GetXmin())/nBins;
+   return f->GetXmin() + (bin+frac)*dx;
+}
+
 //______________________________________________________________________________
 void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
 {
@@ -238,6 +305,7 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    } 
    
    fTrials = 0;
+   TRandom *rnd = fRandom ? fRandom : gRandom;
 
    Double_t sumx=0;       
    Double_t sumy=0;       
@@ -246,9 +314,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    Bool_t hulthen = (TString(GetName())=="dh");
    if (fN==2 && hulthen) { //special treatmeant for Hulten
 
-      Double_t r = fFunction->GetRandom()/2;
-      Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-      Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+      Double_t r = GetRandomR()/2;
+      Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+      Double_t ctheta = 2*rnd->Rndm() - 1 ;
       Double_t stheta = sqrt(1-ctheta*ctheta);
      
       AliGlauberNucleon *nucleon1=(AliGlauberNucleon*)(fNucleons->UncheckedAt(0));
@@ -270,9 +338,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
       nucleon->Reset();
       while(1) {
          fTrials++;
-         Double_t r = fFunction->GetRandom();
-         Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-         Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+         Double_t r = GetRandomR();
+         Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+         Double_t ctheta = 2*rnd->Rndm() - 1 ;
          Double_t stheta = TMath::Sqrt(1-ctheta*ctheta);
          Double_t x = r * stheta * cos(phi) + xshift;
          Double_t y = r * stheta * sin(phi);      
@@ -16,8 +16,10 @@
 
 //class TNamed;
 #include <TNamed.h>
+#include <vector>
 class TObjArray;
 class TF1;
+class TRandom;
 
 class AliGlauberNucleus : public TNamed {
 private:
@@ -30,8 +32,11 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   TRandom*   fRandom;     //!Random generator, gRandom if not set
+   std::vector<Double_t> fCdf; //!Cumulative integral of fFunction, used with fRandom
 
    void       Lookup(Option_t* name);
+   Double_t   GetRandomR();
 
 public:
    AliGlauberNucleus(Option_t* iname="Au", Int_t iN=0, Double_t iR=0, Double_t ia=0, Double_t iw=0, TF1* ifunc=0);
@@ -52,8 +57,12 @@ public:
    void       SetA(Double_t ia);
    void       SetW(Double_t iw);
    void       SetMinDist(Double_t min) {fMinDist=min;}
+   void       SetRandom(TRandom *rnd);
    void       ThrowNucleons(Double_t xshift=0.);
 
+   static void     TabulateFunction(TF1 *f, std::vector<Double_t> &cdf);
+   static Double_t GetRandomFromTable(const TF1 *f, const std::vector<Double_t> &cdf, TRandom *rnd);
+
    ClassDef(AliGlauberNucleus,1)
 };
 
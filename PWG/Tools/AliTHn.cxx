@@ -40,8 +40,13 @@
 #include "THnSparse.h"
 #include "TMath.h"
 
+#include <algorithm>
+
 templateClassImp(AliTHnT)
 
+// number of points for which FillN computes the global bin indices in one go
+static const Int_t kFillNBlockSize = 256;
+
 template <class TemplateArray, typename TemplateType>
 AliTHnT<TemplateArray, TemplateType>::AliTHnT() : 
   AliTHnBase(),
@@ -53,7 +58,10 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMinCache(0),
+  fAxisRangeCache(0),
+  fFillNBins(0)
 {
   // Constructor
 }
@@ -69,7 +77,10 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMinCache(0),
+  fAxisRangeCache(0),
+  fFillNBins(0)
 {
   // Constructor
 
@@ -106,7 +117,10 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMinCache(0),
+  fAxisRangeCache(0),
+  fFillNBins(0)
 {
   //
   // AliTHnT copy constructor
@@ -135,6 +149,9 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  delete[] fAxisMinCache;
+  delete[] fAxisRangeCache;
+  delete[] fFillNBins;
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -191,9 +208,21 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
       fValues = 0;
       fSumw2 = 0;
     }
+    // the caches are rebuilt on the next Fill from the axes of this object
     delete [] axisCache;
-    axisCache = new TAxis*[fNVars];
-    memcpy(axisCache, c.axisCache, fNVars*sizeof(TAxis*));
+    delete [] fNbinsCache;
+    delete [] fLastVars;
+    delete [] fLastBins;
+    delete [] fAxisMinCache;
+    delete [] fAxisRangeCache;
+    delete [] fFillNBins;
+    axisCache = 0;
+    fNbinsCache = 0;
+    fLastVars = 0;
+    fLastBins = 0;
+    fAxisMinCache = 0;
+    fAxisRangeCache = 0;
+    fFillNBins = 0;
   }
   return *this;
 }
@@ -228,6 +257,21 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
   }
 }
 
+//____________________________________________________________________
+template <class TemplateArray, typename TemplateType>
+AliTHnT<TemplateArray, TemplateType>* AliTHnT<TemplateArray, TemplateType>::CreateShard() const
+{
+  // creates an empty container with the same binning as this one
+  //
+  // Each worker thread fills its own shard, no locking is needed as shards do not share any state.
+  // Afterwards the shards are added to this object with Merge(), which sums them in the order of the list 
+  // and thus gives the same result independent of the thread scheduling.
+  
+  AliTHnT* shard = new AliTHnT(*this);
+  shard->DeleteContainers();
+  return shard;
+}
+
 //____________________________________________________________________
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
@@ -287,15 +331,10 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
   // fills an entry
 
   // fill axis cache
-  if (!axisCache)
+  if (!fLastVars)
   {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
+    if (!fAxisMinCache)
+      InitAxisCache();
     
     fLastVars = new Double_t[fNVars];
     fLastBins = new Int_t[fNVars];
@@ -360,6 +399,138 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache()
+{
+  // caches axis pointers and binning information used by Fill and FillN
+  
+  delete[] axisCache;
+  delete[] fNbinsCache;
+  delete[] fAxisMinCache;
+  delete[] fAxisRangeCache;
+  delete[] fFillNBins;
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fAxisMinCache = new Double_t[fNVars];
+  fAxisRangeCache = new Double_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    fAxisMinCache[i] = axisCache[i]->GetXmin();
+    // variable binning is flagged by a range of 0 and resolved by binary search over the bin edges
+    fAxisRangeCache[i] = (axisCache[i]->GetXbins()->GetSize() == 0) ? axisCache[i]->GetXmax() - axisCache[i]->GetXmin() : 0;
+  }
+  
+  fFillNBins = new Long64_t[kFillNBlockSize];
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t nPoints, const Double_t *soaVars, Int_t istep, const Double_t *weights)
+{
+  // fills <nPoints> entries at once
+  //
+  // soaVars is stored variable by variable (structure of arrays): 
+  //   the value of variable i for point p is soaVars[i * nPoints + p]
+  // weights has <nPoints> entries, if 0 all entries are filled with weight 1
+  //
+  // The global bin indices are computed axis by axis for blocks of points. For uniform axes the bin is computed 
+  // with the same arithmetic as TAxis::FindBin, for variable axes by a binary search over the bin edges, 
+  // so that the result is identical to calling Fill for each point.
+  
+  if (nPoints <= 0)
+    return;
+  
+  if (!fAxisMinCache)
+    InitAxisCache();
+  
+  if (!fValues[istep])
+  {
+    fValues[istep] = new TemplateArray(fNBins);
+    AliInfo(Form("Created values container for step %d", istep));
+  }
+  
+  if (weights && !fSumw2[istep])
+  {
+    for (Int_t p=0; p<nPoints; p++)
+    {
+      if (weights[p] != 1)
+      {
+        // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+        fSumw2[istep] = new TemplateArray(*fValues[istep]);
+        AliInfo(Form("Created sumw2 container for step %d", istep));
+        break;
+      }
+    }
+  }
+  
+  TemplateType* values = fValues[istep]->GetArray();
+  TemplateType* sumw2 = (fSumw2[istep]) ? fSumw2[istep]->GetArray() : 0;
+  Long64_t* bins = fFillNBins;
+  
+  for (Int_t start=0; start<nPoints; start+=kFillNBlockSize)
+  {
+    const Int_t n = TMath::Min(kFillNBlockSize, nPoints - start);
+    
+    for (Int_t p=0; p<n; p++)
+      bins[p] = 0;
+    
+    for (Int_t i=0; i<fNVars; i++)
+    {
+      const Double_t* x = soaVars + (Long64_t) i * nPoints + start;
+      const Int_t nBins = fNbinsCache[i];
+      
+      // under/overflow not supported: a point outside of any axis gets a negative index and is skipped below
+      if (fAxisRangeCache[i] > 0)
+      {
+        const Double_t xMin = fAxisMinCache[i];
+        const Double_t range = fAxisRangeCache[i];
+        const Double_t xMax = xMin + range;
+        for (Int_t p=0; p<n; p++)
+        {
+          const Bool_t inside = (x[p] >= xMin && x[p] < xMax);
+          const Long64_t tmpBin = inside ? (Long64_t) (nBins * (x[p] - xMin) / range) : -1;
+          bins[p] = (bins[p] < 0 || tmpBin < 0 || tmpBin >= nBins) ? -1 : bins[p] * nBins + tmpBin;
+        }
+      }
+      else
+      {
+        const Double_t* edges = axisCache[i]->GetXbins()->GetArray();
+        for (Int_t p=0; p<n; p++)
+        {
+          const Long64_t tmpBin = (std::upper_bound(edges, edges + nBins + 1, x[p]) - edges) - 1;
+          bins[p] = (bins[p] < 0 || tmpBin < 0 || tmpBin >= nBins) ? -1 : bins[p] * nBins + tmpBin;
+        }
+      }
+    }
+    
+    if (weights)
+    {
+      const Double_t* w = weights + start;
+      for (Int_t p=0; p<n; p++)
+      {
+        if (bins[p] < 0)
+          continue;
+        values[bins[p]] += w[p];
+        if (sumw2)
+          sumw2[bins[p]] += w[p] * w[p];
+      }
+    }
+    else
+    {
+      for (Int_t p=0; p<n; p++)
+      {
+        if (bins[p] < 0)
+          continue;
+        values[bins[p]] += 1;
+        if (sumw2)
+          sumw2[bins[p]] += 1;
+      }
+    }
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
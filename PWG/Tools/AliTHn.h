@@ -48,6 +48,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  void FillN(Int_t nPoints, const Double_t *soaVars, Int_t istep, const Double_t *weights=0);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -62,9 +63,12 @@ class AliTHnT : public AliTHnBase
   virtual void Copy(TObject& c) const;
 
   virtual Long64_t Merge(TCollection* list);
+
+  AliTHnT* CreateShard() const;
   
 protected:
   void Init();
+  void InitAxisCache();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
   
   Long64_t fNBins;   // number of total bins
@@ -77,6 +81,9 @@ protected:
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Double_t* fAxisMinCache; //! lower edge per axis (fast path for uniform binning in FillN)
+  Double_t* fAxisRangeCache; //! axis range per axis, 0 for variable binning
+  Long64_t* fFillNBins; //! scratch buffer with global bin indices of one FillN block
   
   ClassDef(AliTHnT, 5) // THn like container
 };
@@ -21,6 +21,7 @@
 #pragma link C++ class AliTHnT<TArrayF, Float_t>+;
 #pragma link C++ class AliTHnT<TArrayD, Double_t>+;
 #pragma link C++ class THistManager+;
+#pragma link C++ class THistManager::THMHandle+;
 #pragma link C++ class AliJSONReader+;
 #pragma link C++ class AliJSONData+;
 #pragma link C++ class AliJSONValue+;
@@ -51,4 +52,5 @@
 #pragma link C++ function TestTHistManager::TestRunBuildGrouped();
 #pragma link C++ function TestTHistManager::TestRunFillSimple();
 #pragma link C++ function TestTHistManager::TestRunFillGrouped();
+#pragma link C++ function TestTHistManager::TestRunFillHandle();
 #endif
@@ -42,14 +42,16 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandleCache()
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandleCache()
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -409,26 +411,7 @@ void THistManager::SetObject(TObject * const o, const char *group) {
 }
 
 void THistManager::FillTH1(const char *name, double x, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
-	TString optionstring(opt);
-	if(optionstring.Contains("w")){
-	  // use bin width as weight
-	  Int_t bin = hist->GetXaxis()->FindBin(x);
-	  // check if not overflow or underflow bin
-	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
-	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
-	}
-	hist->Fill(x, weight);
+	FillTH1Hist(FindHistogram<TH1>(name, "THistManager::FillTH1"), x, weight, opt);
 }
 
 void THistManager::FillTH1(const char *name, const char *label, double weight, Option_t *opt) {
@@ -456,28 +439,7 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
 }
 
 void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
-	TString optstring(opt);
-	Double_t myweight = optstring.Contains("w") ? 1. : weight;
-	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(x);
-	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-	}
-	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(y);
-	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-	}
-	hist->Fill(x, y, myweight);
+	FillTH2Hist(FindHistogram<TH2>(name, "THistManager::FillTH2"), x, y, weight, opt);
 }
 
 void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
@@ -531,6 +493,10 @@ void THistManager::FillTH2(const char *name, const char *labelX, const char *lab
 }
 
 void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
+	FillTH3Hist(FindHistogram<TH3>(name, "THistManager::FillTH3"), x, y, z, weight, opt);
+}
+
+void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
@@ -545,61 +511,103 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(x);
+	  Int_t binx = hist->GetXaxis()->FindBin(point[0]);
 	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
 	}
 	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(y);
+	  Int_t biny = hist->GetYaxis()->FindBin(point[1]);
 	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
 	}
 	if(optstring.Contains("wz")){
-	  Int_t binz = hist->GetZaxis()->FindBin(z);
+	  Int_t binz = hist->GetZaxis()->FindBin(point[2]);
 	  if(binz != 0 && binz != hist->GetZaxis()->GetNbins()) myweight *= 1./hist->GetZaxis()->GetBinWidth(binz);
 	}
-	hist->Fill(x, y, z, weight);
+	hist->Fill(point[0], point[1], point[2], weight);
 }
 
-void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
+void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
+	FillTHnSparseHist(FindHistogram<THnSparse>(name, "THistManager::FillTHnSparse"), x, weight, opt);
+}
+
+void THistManager::FillProfile(const char* name, double x, double y, double weight){
+  FindHistogram<TProfile>(name, "THistManager::FillTProfile")->Fill(x, y, weight);
+}
+
+THistManager::THMHandle THistManager::GetHandle(const char *name) {
+  TObject *hist = FindHistogram<TObject>(name, "THistManager::GetHandle");
+  for(std::vector<TObject *>::size_type ihist = 0; ihist < fHandleCache.size(); ihist++){
+    // histogram already registered
+    if(fHandleCache[ihist] == hist) return THMHandle(ihist);
+  }
+  fHandleCache.push_back(hist);
+  return THMHandle(fHandleCache.size() - 1);
+}
+
+void THistManager::FillTH1(const THMHandle &handle, double x, double weight, Option_t *opt) {
+  FillTH1Hist(GetHandledHistogram<TH1>(handle, "THistManager::FillTH1"), x, weight, opt);
+}
+
+void THistManager::FillTH2(const THMHandle &handle, double x, double y, double weight, Option_t *opt) {
+  FillTH2Hist(GetHandledHistogram<TH2>(handle, "THistManager::FillTH2"), x, y, weight, opt);
+}
+
+void THistManager::FillTH3(const THMHandle &handle, double x, double y, double z, double weight, Option_t *opt) {
+  FillTH3Hist(GetHandledHistogram<TH3>(handle, "THistManager::FillTH3"), x, y, z, weight, opt);
+}
+
+void THistManager::FillTHnSparse(const THMHandle &handle, const double *x, double weight, Option_t *opt) {
+  FillTHnSparseHist(GetHandledHistogram<THnSparse>(handle, "THistManager::FillTHnSparse"), x, weight, opt);
+}
+
+void THistManager::FillProfile(const THMHandle &handle, double x, double y, double weight){
+  GetHandledHistogram<TProfile>(handle, "THistManager::FillTProfile")->Fill(x, y, weight);
+}
+
+void THistManager::FillTH1Hist(TH1 *hist, double x, double weight, Option_t *opt) {
+	TString optionstring(opt);
+	if(optionstring.Contains("w")){
+	  // use bin width as weight
+	  Int_t bin = hist->GetXaxis()->FindBin(x);
+	  // check if not overflow or underflow bin
+	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
+	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
 	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
+	hist->Fill(x, weight);
+}
+
+void THistManager::FillTH2Hist(TH2 *hist, double x, double y, double weight, Option_t *opt) {
+	TString optstring(opt);
+	Double_t myweight = optstring.Contains("w") ? 1. : weight;
+	if(optstring.Contains("wx")){
+	  Int_t binx = hist->GetXaxis()->FindBin(x);
+	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
+	}
+	if(optstring.Contains("wy")){
+	  Int_t biny = hist->GetYaxis()->FindBin(y);
+	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
 	}
+	hist->Fill(x, y, myweight);
+}
+
+void THistManager::FillTH3Hist(TH3 *hist, double x, double y, double z, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(point[0]);
+	  Int_t binx = hist->GetXaxis()->FindBin(x);
 	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
 	}
 	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(point[1]);
+	  Int_t biny = hist->GetYaxis()->FindBin(y);
 	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
 	}
 	if(optstring.Contains("wz")){
-	  Int_t binz = hist->GetZaxis()->FindBin(point[2]);
+	  Int_t binz = hist->GetZaxis()->FindBin(z);
 	  if(binz != 0 && binz != hist->GetZaxis()->GetNbins()) myweight *= 1./hist->GetZaxis()->GetBinWidth(binz);
 	}
-	hist->Fill(point[0], point[1], point[2], weight);
+	hist->Fill(x, y, z, weight);
 }
 
-void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTHnSparse", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	THnSparseD *hist = dynamic_cast<THnSparseD *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+void THistManager::FillTHnSparseHist(THnSparse *hist, const double *x, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
@@ -614,15 +622,34 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 	hist->Fill(x, weight);
 }
 
-void THistManager::FillProfile(const char* name, double x, double y, double weight){
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent)
-		Fatal("THistManager::FillTProfile", "Parent group %s does not exist", dirname.Data());
-  TProfile *hist = dynamic_cast<TProfile *>(parent->FindObject(hname));
-  if(!hist)
-		Fatal("THistManager::FillTProfile", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-  hist->Fill(x, y, weight);
+template<typename HistType>
+HistType *THistManager::FindHistogram(const char *name, const char *method) const {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal(method, "Parent group %s does not exist", dirname.Data());
+		return nullptr;
+	}
+	HistType *hist = dynamic_cast<HistType *>(parent->FindObject(hname));
+	if(!hist){
+		Fatal(method, "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return nullptr;
+	}
+	return hist;
+}
+
+template<typename HistType>
+HistType *THistManager::GetHandledHistogram(const THMHandle &handle, const char *method) const {
+	if(!handle.IsValid() || handle.GetIndex() >= static_cast<Int_t>(fHandleCache.size())){
+		Fatal(method, "Invalid histogram handle %d", handle.GetIndex());
+		return nullptr;
+	}
+	HistType *hist = dynamic_cast<HistType *>(fHandleCache[handle.GetIndex()]);
+	if(!hist){
+		Fatal(method, "Histogram %s registered with handle %d has a wrong type", fHandleCache[handle.GetIndex()]->GetName(), handle.GetIndex());
+		return nullptr;
+	}
+	return hist;
 }
 
 TObject *THistManager::FindObject(const char *name) const {
@@ -1030,6 +1057,79 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Group1/Test1", "Test Histogram 1 in group 1", 1, 0., 1.);
+    testmgr.CreateTH2("Group2/Test1", "Test Histogram 1 in group 2", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Group3/Test1", "Test Histogram 1 in group 3", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("Group4/Subgroup1/TestN", "Test Fill THnSparse", 4, nbins, min, max);
+    testmgr.CreateTProfile("Group4/Subgroup1/TestProfile", "Test histogram for subgroup handling", 1, 0., 1);
+
+    THistManager::THMHandle h1 = testmgr.GetHandle("Group1/Test1"),
+                            h2 = testmgr.GetHandle("Group2/Test1"),
+                            h3 = testmgr.GetHandle("Group3/Test1"),
+                            hN = testmgr.GetHandle("Group4/Subgroup1/TestN"),
+                            hProfile = testmgr.GetHandle("Group4/Subgroup1/TestProfile");
+
+    // Evalutate test
+    // tell user why test has failed
+    bool success(true);
+    if(!(h1.IsValid() && h2.IsValid() && h3.IsValid() && hN.IsValid() && hProfile.IsValid())){
+      std::cout << "Invalid handle returned by GetHandle" << std::endl;
+      return 1;
+    }
+    if(testmgr.GetHandle("Group1/Test1").GetIndex() != h1.GetIndex()){
+      std::cout << "Group1/Test1: Registered twice" << std::endl;
+      success = false;
+    }
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(h1, 0.5);
+      testmgr.FillTH2(h2, 0.5, 0.5);
+      testmgr.FillTH3(h3, 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse(hN, point);
+      testmgr.FillProfile(hProfile, 0.5, 1.);
+      // mix with fill by name, both need to end up in the same histogram
+      testmgr.FillTH1("Group1/Test1", 0.5);
+      testmgr.FillTH2("Group2/Test1", 0.5, 0.5);
+      testmgr.FillTH3("Group3/Test1", 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse("Group4/Subgroup1/TestN", point);
+      testmgr.FillProfile("Group4/Subgroup1/TestProfile", 0.5, 1.);
+    }
+
+    TH1 *test1 = dynamic_cast<TH1 *>(testmgr.FindObject("Group1/Test1"));
+    if(!test1 || TMath::Abs(test1->GetBinContent(1) - 200) > DBL_EPSILON){
+      std::cout << "Group1/Test1: Not found or value mismatch, expected 200" << std::endl;
+      success = false;
+    }
+    TH2 *test2 = dynamic_cast<TH2 *>(testmgr.FindObject("Group2/Test1"));
+    if(!test2 || TMath::Abs(test2->GetBinContent(1, 1) - 200) > DBL_EPSILON){
+      std::cout << "Group2/Test1: Not found or value mismatch, expected 200" << std::endl;
+      success = false;
+    }
+    TH3 *test3 = dynamic_cast<TH3 *>(testmgr.FindObject("Group3/Test1"));
+    if(!test3 || TMath::Abs(test3->GetBinContent(1, 1, 1) - 200) > DBL_EPSILON){
+      std::cout << "Group3/Test1: Not found or value mismatch, expected 200" << std::endl;
+      success = false;
+    }
+    THnSparse *testN = dynamic_cast<THnSparse *>(testmgr.FindObject("Group4/Subgroup1/TestN"));
+    int index[4] = {1,1,1,1};
+    if(!testN || TMath::Abs(testN->GetBinContent(index) - 200) > DBL_EPSILON){
+      std::cout << "Group4/Subgroup1/TestN: Not found or value mismatch, expected 200" << std::endl;
+      success = false;
+    }
+    TProfile *testProfile = dynamic_cast<TProfile *>(testmgr.FindObject("Group4/Subgroup1/TestProfile"));
+    if(!testProfile || TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "Group4/Subgroup1/TestProfile: Not found or value mismatch, expected 1" << std::endl;
+      success = false;
+    }
+
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1150,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1176,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
 }
@@ -7,6 +7,7 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <vector>
 
 class TArrayD;
 class TAxis;
@@ -95,6 +96,19 @@ class TProfile;
  * an argument for options. Automatic correction for the bin width is done when
  * specifying the argument *W*, followed by the direction. Adding multiple directions
  * the weight is calculated for all directions at the same time.
+ *
+ * ## Filling via handles
+ * Filling by name requires the group path to be parsed and the histogram to be
+ * looked up in the hash lists for every fill. For histograms filled per track or
+ * per cluster the lookup can be done once with GetHandle, and the histogram can
+ * be filled afterwards via the returned handle:
+ * ~~~{.cxx}
+ * THistManager::THMHandle hPtHandle = mgr.GetHandle("hPt");
+ * for(auto en : ROOT::TSeqI(0, 10000) {
+ *   mgr.FillTH1(hPtHandle, gRandom->Exp(-1));
+ * }
+ * ~~~
+ * Handles stay valid for the lifetime of the histogram manager.
  */
 class THistManager : public TNamed {
 public:
@@ -229,6 +243,45 @@ public:
     iterator();
   };
 
+  /**
+   * @class THMHandle
+   * @brief Handle to a histogram for fast filling
+   * @ingroup Histmanager
+   *
+   * Handle obtained from THistManager::GetHandle. It stores the
+   * index of the histogram in the flat list of registered histograms,
+   * so that the Fill methods taking a handle do not need to look up
+   * the histogram by name.
+   */
+  class THMHandle {
+  public:
+    /**
+     * @brief Default constructor, creating an invalid handle
+     */
+    THMHandle(): fIndex(-1) {}
+
+    /**
+     * @brief Constructor, creating a handle for the histogram at a given index
+     * @param[in] index Index of the histogram in the list of registered histograms
+     */
+    explicit THMHandle(Int_t index): fIndex(index) {}
+
+    /**
+     * @brief Check whether the handle points to a registered histogram
+     * @return True if the handle is valid
+     */
+    Bool_t IsValid() const { return fIndex >= 0; }
+
+    /**
+     * @brief Get the index of the histogram in the list of registered histograms
+     * @return Index of the histogram
+     */
+    Int_t GetIndex() const { return fIndex; }
+
+  private:
+    Int_t fIndex;             ///< Index of the histogram in the list of registered histograms
+  };
+
   /**
    * @brief Default constructor.
    *
@@ -634,6 +687,64 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Register a histogram for filling via handle.
+   *
+   * The histogram is looked up once by its name (following the common
+   * group notation) and added to the list of registered histograms.
+   * @param[in] name Name of the histogram, including parent group(s)
+   * @return Handle to the histogram
+   */
+  THMHandle GetHandle(const char *name);
+
+  /**
+   * @brief Fill a 1D histogram registered via GetHandle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments, same as for the fill by name
+   */
+  void FillTH1(const THMHandle &handle, double x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram registered via GetHandle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments, same as for the fill by name
+   */
+  void FillTH2(const THMHandle &handle, double x, double y, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram registered via GetHandle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments, same as for the fill by name
+   */
+  void FillTH3(const THMHandle &handle, double x, double y, double z, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a nD histogram registered via GetHandle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments, same as for the fill by name
+   */
+  void FillTHnSparse(const THMHandle &handle, const double *x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a profile histogram registered via GetHandle.
+   * @param[in] handle Handle to the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(const THMHandle &handle, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -719,8 +830,34 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Find histogram by name and check its type.
+	 * Fatal in case the parent group or the histogram does not exist.
+	 * @param[in] name Name of the histogram, including parent group(s)
+	 * @param[in] method Name of the calling method for error messages
+	 * @return Histogram with the given name
+	 */
+	template<typename HistType>
+	HistType *FindHistogram(const char *name, const char *method) const;
+
+	/**
+	 * @brief Get histogram registered via GetHandle and check its type.
+	 * Fatal in case the handle is invalid or the type does not match.
+	 * @param[in] handle Handle to the histogram
+	 * @param[in] method Name of the calling method for error messages
+	 * @return Histogram connected to the handle
+	 */
+	template<typename HistType>
+	HistType *GetHandledHistogram(const THMHandle &handle, const char *method) const;
+
+	void FillTH1Hist(TH1 *hist, double x, double weight, Option_t *opt);
+	void FillTH2Hist(TH2 *hist, double x, double y, double weight, Option_t *opt);
+	void FillTH3Hist(TH3 *hist, double x, double y, double z, double weight, Option_t *opt);
+	void FillTHnSparseHist(THnSparse *hist, const double *x, double weight, Option_t *opt);
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	std::vector<TObject *> fHandleCache;  //!<! Histograms registered via GetHandle, indexed by the handle
 
   /// \cond CLASSIMP
 	ClassDef(THistManager, 1);  // Container for histograms
@@ -845,6 +982,22 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via handles
+   * Relies on: TestBuildGroupedHistograms, TestFillGroupedHistograms
+   * Fill histograms of all types in groups
+   * - Group1: TH1
+   * - Group2: TH2
+   * - Group3: TH3
+   * - Group4/Subgroup1: THnSparse and TProfile
+   * each 100 times via handle and 100 times via name for bin 1.
+   * Test passed:
+   * - All handles are valid
+   * - All Histograms have the expected value (200 for histograms, 1 for profile)
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
 };
 
 /**
@@ -882,5 +1035,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
 }
 #endif
@@ -37,8 +37,64 @@
 #include "TMath.h"
 #include "TLorentzVector.h"
 
+#include <vector>
+
 ClassImp(AliUEHistograms)
 
+namespace {
+  // particle list packed into contiguous arrays (structure of arrays)
+  // used in the O(N^2) loops of FillCorrelations instead of virtual calls through the TObjArray
+  struct AliUEPackedParticles
+  {
+    AliUEPackedParticles() : fN(0) { }
+    
+    Int_t fN;                                  // number of particles
+    std::vector<AliVParticle*> fParticles;     // original particles
+    std::vector<Double_t> fPt;                 // pt
+    std::vector<Double_t> fPhi;                // phi
+    std::vector<Float_t> fEta;                 // eta (Float_t as cached before)
+    std::vector<Short_t> fCharge;              // charge
+    std::vector<Long64_t> fEventIndex;         // event index (only filled for AliBasicParticles if requested, 0 otherwise)
+    std::vector<UChar_t> fResonanceDaughter;   // flag for daughters of resonance candidates
+  };
+
+  Bool_t PackParticles(TObjArray* list, AliUEPackedParticles& packed, Bool_t fillEventIndex)
+  {
+    // fills the packed arrays from <list>
+    // returns kFALSE if the event index is requested but a particle is not derived from AliBasicParticle
+    
+    const Int_t n = list->GetEntriesFast();
+    packed.fN = n;
+    packed.fParticles.resize(n);
+    packed.fPt.resize(n);
+    packed.fPhi.resize(n);
+    packed.fEta.resize(n);
+    packed.fCharge.resize(n);
+    packed.fEventIndex.assign(n, 0);
+    packed.fResonanceDaughter.assign(n, 0);
+    
+    for (Int_t i=0; i<n; i++)
+    {
+      AliVParticle* particle = (AliVParticle*) list->UncheckedAt(i);
+      packed.fParticles[i] = particle;
+      packed.fPt[i] = particle->Pt();
+      packed.fPhi[i] = particle->Phi();
+      packed.fEta[i] = particle->Eta();
+      packed.fCharge[i] = particle->Charge();
+      
+      if (fillEventIndex)
+      {
+        AliBasicParticle* particleBasic = dynamic_cast<AliBasicParticle*>(particle);
+        if (!particleBasic)
+          return kFALSE;
+        packed.fEventIndex[i] = particleBasic->GetEventIndex();
+      }
+    }
+    
+    return kTRUE;
+  }
+}
+
 const Int_t AliUEHistograms::fgkUEHists = 3;
 
 AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const char* binning) : 
@@ -591,18 +647,23 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     TH1::AddDirectory(oldStatus);
   }
 
-  // Eta() is extremely time consuming, therefore cache it for the inner loop here:
-  TObjArray* input = (mixed) ? mixed : particles;
-  TArrayF eta(input->GetEntriesFast());
-  for (Int_t i=0; i<input->GetEntriesFast(); i++)
-    eta[i] = ((AliVParticle*) input->UncheckedAt(i))->Eta();
-  
   // if particles is not set, just fill event statistics
   if (particles)
   {
-    Int_t jMax = particles->GetEntriesFast();
-    if (mixed)
-      jMax = mixed->GetEntriesFast();
+    // the virtual accessors (in particular Eta()) are time consuming, therefore the particle lists are packed once
+    // into contiguous arrays which are used in the O(N^2) loops below
+    // for same-event correlations trigger and associated particles are the same list
+    AliUEPackedParticles triggers;
+    AliUEPackedParticles mixedAssociated;
+    if (!PackParticles(particles, triggers, fCheckEventNumberInCorrelation) || (mixed && !PackParticles(mixed, mixedAssociated, fCheckEventNumberInCorrelation)))
+      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+    AliUEPackedParticles& associated = (mixed) ? mixedAssociated : triggers;
+    
+    const Int_t iMax = triggers.fN;
+    const Int_t jMax = associated.fN;
+    
+    // accepted associated particles for the current trigger particle
+    std::vector<UChar_t> accepted(jMax);
     
     TH1* triggerWeighting = 0;
     if (fWeightPerEvent)
@@ -610,12 +671,10 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
       triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
     
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<iMax; i++)
       {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
 	// some optimization
-	Float_t triggerEta = triggerParticle->Eta();
+	Float_t triggerEta = triggers.fEta[i];
 
 	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
 	  continue;
@@ -627,16 +686,14 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	if (fTriggerSelectCharge != 0)
-	  if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	  if (triggers.fCharge[i] * fTriggerSelectCharge < 0)
 	    continue;
 	
-	triggerWeighting->Fill(triggerParticle->Pt());
+	triggerWeighting->Fill(triggers.fPt[i]);
       }
     }
     
     // identify K, Lambda candidates and flag those particles
-    // a TObject bit is used for this
-    const UInt_t kResonanceDaughterFlag = 1 << 14;
     if (fRejectResonanceDaughters > 0)
     {
       Double_t resonanceMass = -1;
@@ -652,57 +709,36 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	default: AliFatal(Form("Invalid setting %d", fRejectResonanceDaughters));
       }
 
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
-	particles->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
-      if (mixed)
-	for (Int_t i=0; i<jMax; i++)
-	  mixed->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
-      
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<iMax; i++)
       {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+	const Short_t triggerCharge = triggers.fCharge[i];
+	const Long64_t triggerEventIndex = triggers.fEventIndex[i];
+	
+	// cheap pair selection evaluated as mask over all associated particles
+	for (Int_t j=0; j<jMax; j++)
+	  accepted[j] = (mixed || i != j) 
+	    & (!fCheckEventNumberInCorrelation || triggerEventIndex != associated.fEventIndex[j]) 
+	    & (triggerCharge * associated.fCharge[j] <= 0);
 	
 	for (Int_t j=0; j<jMax; j++)
 	{
-	  if (!mixed && i == j)
+	  if (!accepted[j])
 	    continue;
-	
-	  AliVParticle* particle = 0;
-	  if (!mixed)
-	    particle = (AliVParticle*) particles->UncheckedAt(j);
-	  else
-	    particle = (AliVParticle*) mixed->UncheckedAt(j);
 	  
 	  // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
-	  if (fCheckEventNumberInCorrelation)
-	  {
-	    AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-	    AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
-	    if(!triggerParticleBasic || !particleBasic)
-	    {
-	      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
-	      continue;
-	    }
-	
-	    if(triggerParticleBasic->IsInSameEvent(particleBasic))
-	      continue;
-	  }
-	  else if (mixed && triggerParticle->IsEqual(particle))
-	    continue;
-	  
-	  if (triggerParticle->Charge() * particle->Charge() > 0)
+	  if (!fCheckEventNumberInCorrelation && mixed && triggers.fParticles[i]->IsEqual(associated.fParticles[j]))
 	    continue;
       
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	  Float_t mass = GetInvMassSquaredCheap(triggers.fPt[i], triggers.fEta[i], triggers.fPhi[i], associated.fPt[j], associated.fEta[j], associated.fPhi[j], massDaughter1, massDaughter2);
 	      
 	  if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	    mass = GetInvMassSquared(triggers.fPt[i], triggers.fEta[i], triggers.fPhi[i], associated.fPt[j], associated.fEta[j], associated.fPhi[j], massDaughter1, massDaughter2);
 
 	    if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
 	    {
-	      triggerParticle->SetBit(kResonanceDaughterFlag);
-	      particle->SetBit(kResonanceDaughterFlag);
+	      triggers.fResonanceDaughter[i] = 1;
+	      associated.fResonanceDaughter[j] = 1;
 	      
 // 	      Printf("Flagged %d %d %f", i, j, TMath::Sqrt(mass));
 	    }
@@ -711,12 +747,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
-    for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+    for (Int_t i=0; i<iMax; i++)
     {
-      AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+      AliVParticle* triggerParticle = triggers.fParticles[i];
       
       // some optimization
-      Float_t triggerEta = triggerParticle->Eta();
+      const Float_t triggerEta = triggers.fEta[i];
+      const Double_t triggerPt = triggers.fPt[i];
+      const Double_t triggerPhi = triggers.fPhi[i];
+      const Short_t triggerCharge = triggers.fCharge[i];
+      const Long64_t triggerEventIndex = triggers.fEventIndex[i];
       
       if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
 	continue;
@@ -728,87 +768,56 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
       
       if (fTriggerSelectCharge != 0)
-	if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	if (triggerCharge * fTriggerSelectCharge < 0)
 	  continue;
 	
       if (fRejectResonanceDaughters > 0)
-	if (triggerParticle->TestBit(kResonanceDaughterFlag))
+	if (triggers.fResonanceDaughter[i])
 	{
 // 	  Printf("Skipped i=%d", i);
 	  continue;
 	}
 	
+      // evaluate all single-particle and cheap pair cuts as mask over the associated particles
+      // the expressions are combined without branches to allow vectorization of this loop
       for (Int_t j=0; j<jMax; j++)
       {
-        if (!mixed && i == j)
-          continue;
+        const Short_t chargeProduct = associated.fCharge[j] * triggerCharge;
+        const Float_t assocEta = associated.fEta[j];
+        accepted[j] = (mixed || i != j)
+          & (!fCheckEventNumberInCorrelation || triggerEventIndex != associated.fEventIndex[j])
+          & (!fPtOrder || associated.fPt[j] < triggerPt)
+          & (fAssociatedSelectCharge == 0 || associated.fCharge[j] * fAssociatedSelectCharge >= 0)
+          // skip like sign (1) or unlike sign (2)
+          & (fSelectCharge != 1 || chargeProduct <= 0)
+          & (fSelectCharge != 2 || chargeProduct >= 0)
+          & (fOnlyOneAssocEtaSide == 0 || fOnlyOneAssocEtaSide * assocEta >= 0)
+          & (!fEtaOrdering || ((triggerEta >= 0 || assocEta >= triggerEta) & (triggerEta <= 0 || assocEta <= triggerEta)))
+          & (fRejectResonanceDaughters <= 0 || !associated.fResonanceDaughter[j]);
+      }
       
-        AliVParticle* particle = 0;
-        if (!mixed)
-          particle = (AliVParticle*) particles->UncheckedAt(j);
-        else
-          particle = (AliVParticle*) mixed->UncheckedAt(j);
+      for (Int_t j=0; j<jMax; j++)
+      {
+        if (!accepted[j])
+          continue;
         
         // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
-        if (fCheckEventNumberInCorrelation)
-        {
-          AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-          AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
-          if(!triggerParticleBasic || !particleBasic)
-            AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
-      
-          if(triggerParticleBasic->IsInSameEvent(particleBasic))
-            continue;
-        }
-        else if (mixed && triggerParticle->IsEqual(particle))
+        if (!fCheckEventNumberInCorrelation && mixed && triggerParticle->IsEqual(associated.fParticles[j]))
           continue;
         
-        if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
-	    continue;
-	
-	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
-	    continue;
-
-        if (fSelectCharge > 0)
-        {
-          // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
-            continue;
-            
-          // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
-            continue;
-        }
+        const Double_t assocPt = associated.fPt[j];
+        const Double_t assocPhi = associated.fPhi[j];
+        const Float_t assocEta = associated.fEta[j];
+        const Bool_t unlikeSign = (associated.fCharge[j] * triggerCharge < 0);
         
-        if (fOnlyOneAssocEtaSide != 0)
-          if (fOnlyOneAssocEtaSide * eta[j] < 0)
-            continue;
-
-	if (fEtaOrdering)
-	{
-	  if (triggerEta < 0 && eta[j] < triggerEta)
-	    continue;
-	  if (triggerEta > 0 && eta[j] > triggerEta)
-	    continue;
-	}
-
-	if (fRejectResonanceDaughters > 0)
-	  if (particle->TestBit(kResonanceDaughterFlag))
-	  {
-// 	    Printf("Skipped j=%d", j);
-	    continue;
-	  }
-
 	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutConversionsV > 0 && unlikeSign)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.510e-3, 0.510e-3);
 	  
 	  if (mass < fCutConversionsV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.510e-3, 0.510e-3);
 	    
 	    fControlConvResoncances->Fill(0.0, mass);
 
@@ -818,15 +827,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// K0s
-	if (fCutK0sV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutK0sV > 0 && unlikeSign)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.1396, 0.1396);
 	  
 	  const Float_t kK0smass = 0.4976;
 	  
 	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.1396, 0.1396);
 	    
 	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
 
@@ -836,16 +845,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 
 	// Lambda
-	if (fCutLambdaV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutLambdaV > 0 && unlikeSign)
 	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	  Float_t mass1 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.1396, 0.9383);
+	  Float_t mass2 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.9383, 0.1396);
 	  
 	  const Float_t kLambdaMass = 1.115;
 
 	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
 	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
+	    mass1 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.1396, 0.9383);
 
 	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
 	    
@@ -854,7 +863,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
 	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	    mass2 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.9383, 0.1396);
 
 	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
 
@@ -864,15 +873,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 
         // Phi
-	if (fCutPhiV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutPhiV > 0 && unlikeSign)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.4937, 0.4937);
 	  
 	  const Float_t kPhimass = 1.019;
 	  
 	  if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.4937, 0.4937);
 	    
 	    fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
 	    
@@ -882,15 +891,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}	
 
         // Rho
-	if (fCutRhoV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutRhoV > 0 && unlikeSign)
         {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.1396, 0.1396);
 	  
 	  const Float_t kRhomass = 0.770;
 	  
 	  if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
           {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, 0.1396, 0.1396);
 	    
 	    fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
 	    
@@ -900,13 +909,13 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 
         // User-defined cut
-	if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && unlikeSign)
         {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, fCutCustomFirst, fCutCustomSecond);
 	  
 	  if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
           {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt, assocEta, assocPhi, fCutCustomFirst, fCutCustomSecond);
 	    
 	    fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
 	    
@@ -920,15 +929,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  // the variables & cuthave been developed by the HBT group 
 	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
 
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
+	  Float_t phi1 = triggerPhi;
+	  Float_t pt1 = triggerPt;
+	  Float_t charge1 = triggerCharge;
 	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
+	  Float_t phi2 = assocPhi;
+	  Float_t pt2 = assocPt;
+	  Float_t charge2 = associated.fCharge[j];
 	      
-	  Float_t deta = triggerEta - eta[j];
+	  Float_t deta = triggerEta - assocEta;
 	      
 	  // optimization
 	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
@@ -970,11 +979,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
         
         Double_t vars[6];
-        vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
+        vars[0] = triggerEta - assocEta;
+        vars[1] = assocPt;
+        vars[2] = triggerPt;
         vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
+        vars[4] = triggerPhi - assocPhi;
         if (vars[4] > 1.5 * TMath::Pi()) 
           vars[4] -= TMath::TwoPi();
         if (vars[4] < -0.5 * TMath::Pi())
@@ -982,7 +991,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	vars[5] = zVtx;
 	
 	if (fillpT)
-	  weight = particle->Pt();
+	  weight = assocPt;
 	
 	Double_t useWeight = weight;
 	if (applyEfficiency)
@@ -991,7 +1000,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  {
 	    Int_t effVars[4];
 	    // associated particle
-	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
+	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(assocEta);
 	    effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
 	    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
 	    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
@@ -1022,14 +1031,14 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         // fill all in toward region and do not use the other regions
 	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
 
-// 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
+// 	Printf("%.2f %.2f --> %.2f", triggerEta, assocEta, vars[0]);
       }
  
       if (firstTime)
       {
         // once per trigger particle
         Double_t vars[3];
-        vars[0] = triggerParticle->Pt();
+        vars[0] = triggerPt;
         vars[1] = centrality;
 	vars[2] = zVtx;
 
@@ -1046,8 +1055,8 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
 	}
 
-	if (TMath::Abs(triggerEta) < 0.8 && triggerParticle->Pt() > 0)
-	  fInvYield2->Fill(centrality, triggerParticle->Pt(), useWeight / triggerParticle->Pt());
+	if (TMath::Abs(triggerEta) < 0.8 && triggerPt > 0)
+	  fInvYield2->Fill(centrality, triggerPt, useWeight / triggerPt);
 
 	if (fWeightPerEvent)
 	{
@@ -1060,14 +1069,14 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
 
 	// QA
-        fCorrelationpT->Fill(centrality, triggerParticle->Pt());
+        fCorrelationpT->Fill(centrality, triggerPt);
         fCorrelationEta->Fill(centrality, triggerEta);
-        fCorrelationPhi->Fill(centrality, triggerParticle->Phi());
-	fYields->Fill(centrality, triggerParticle->Pt(), triggerEta);
-	fYieldsEtaPhiPT->Fill(triggerParticle->Pt(), triggerEta, triggerParticle->Phi());
+        fCorrelationPhi->Fill(centrality, triggerPhi);
+	fYields->Fill(centrality, triggerPt, triggerEta);
+	fYieldsEtaPhiPT->Fill(triggerPt, triggerEta, triggerPhi);
 	
 /*        if (dynamic_cast<AliAODTrack*>(triggerParticle))
-          fITSClusterMap->Fill(((AliAODTrack*) triggerParticle)->GetITSClusterMap(), centrality, triggerParticle->Pt());*/
+          fITSClusterMap->Fill(((AliAODTrack*) triggerParticle)->GetITSClusterMap(), centrality, triggerPt);*/
       }
     }
     
@@ -137,6 +137,32 @@ AliFemtoPicoEvent::~AliFemtoPicoEvent(){
   }
 }
 //_________________
+void AliFemtoPicoEvent::Reset()
+{
+  // Delete particles of all collections, the collections themselves are kept
+  AliFemtoParticleCollection* collections[3] = {fFirstParticleCollection, fSecondParticleCollection, fThirdParticleCollection};
+
+  for (int i = 0; i < 3; i++) {
+    if (!collections[i]) {
+      continue;
+    }
+    for (AliFemtoParticleIterator iter = collections[i]->begin(); iter != collections[i]->end(); iter++) {
+      delete *iter;
+    }
+    collections[i]->clear();
+  }
+}
+//_________________
+unsigned int AliFemtoPicoEvent::NumberOfParticles() const
+{
+  // Number of particles stored in this pico event
+  unsigned int n = 0;
+  if (fFirstParticleCollection) n += fFirstParticleCollection->size();
+  if (fSecondParticleCollection) n += fSecondParticleCollection->size();
+  if (fThirdParticleCollection) n += fThirdParticleCollection->size();
+  return n;
+}
+//_________________
 AliFemtoPicoEvent& AliFemtoPicoEvent::operator=(const AliFemtoPicoEvent& aPicoEvent) 
 {
   // Assignment operator
@@ -58,6 +58,13 @@ public:
   AliFemtoParticleCollection* SecondParticleCollection();
   AliFemtoParticleCollection* ThirdParticleCollection();
 
+  /// Delete all stored particles, keeping the (empty) collections so that
+  /// the pico event can be reused for another event without allocation
+  void Reset();
+
+  /// Number of particles stored in all three collections
+  unsigned int NumberOfParticles() const;
+
 private:
   AliFemtoParticleCollection* fFirstParticleCollection;  // Collection of particles of type 1
   AliFemtoParticleCollection* fSecondParticleCollection; // Collection of particles of type 2
@@ -178,6 +178,7 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fSecondParticleCut(nullptr),
   fMixingBuffer(nullptr),
   fPicoEvent(nullptr),
+  fRecycledPicoEvents(),
   fNumEventsToMix(0),
   fNeventsProcessed(0),
   fMinSizePartCollection(0),
@@ -200,6 +201,7 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fSecondParticleCut(nullptr),
   fMixingBuffer(nullptr),
   fPicoEvent(nullptr),
+  fRecycledPicoEvents(),
   fNumEventsToMix(a.fNumEventsToMix),
   fNeventsProcessed(0),
   fMinSizePartCollection(a.fMinSizePartCollection),
@@ -317,6 +319,10 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     }
     delete fMixingBuffer;
   }
+
+  for (auto &event : fRecycledPicoEvents) {
+    delete event;
+  }
 }
 //______________________
 AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAnalysis& aAna)
@@ -441,6 +447,13 @@ AliFemtoString AliFemtoSimpleAnalysis::Report()
     report += cf->Report() + "\n";
   }
 
+  if (fMixingBuffer) {
+    report += TString::Format("\nMixing Buffer: %lu/%u events, %u particles\n",
+                              (unsigned long)fMixingBuffer->size(),
+                              fNumEventsToMix,
+                              MixingBufferParticleCount());
+  }
+
   report += "-------------\n";
 
   return AliFemtoString((const char *)report);
@@ -471,9 +484,8 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // Analysis likes the event -- build a pico event from it, using tracks the
   // analysis likes. This is what we will make pairs from and put in Mixing
   // Buffer.
-  // No memory leak: we will delete picoevents when they come out of the
-  // mixing buffer
-  fPicoEvent = new AliFemtoPicoEvent;
+  // No memory leak: picoevents coming out of the mixing buffer are recycled
+  fPicoEvent = NewPicoEvent();
 
   AliFemtoParticleCollection *collection1 = fPicoEvent->FirstParticleCollection(),
                              *collection2 = fPicoEvent->SecondParticleCollection();
@@ -483,6 +495,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
     cout << "E-AliFemtoSimpleAnalysis::ProcessEvent: new PicoEvent is missing particle collections!\n";
     EventEnd(hbtEvent);  // cleanup for EbyE
     delete fPicoEvent;
+    fPicoEvent = nullptr;
     return;
   }
 
@@ -526,7 +539,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
 
   if (!tmpPassEvent) {
     EventEnd(hbtEvent);
-    delete fPicoEvent;
+    RecyclePicoEvent(fPicoEvent);
     return;
   }
 
@@ -562,19 +575,63 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
     cout << " - mixed done   \n";
   }
 
-  //--------- If mixing buffer is full, delete oldest event ---------//
-  if ( MixingBufferFull() ) {
-    delete MixingBuffer()->back();
-    MixingBuffer()->pop_back();
-  }
-
-  //-------- Add current event (fPicoEvent) to mixing buffer --------//
-  MixingBuffer()->push_front(fPicoEvent);
+  //-------- Add current event (fPicoEvent) to mixing buffer, --------//
+  //-------- recycling the oldest event if the buffer is full  --------//
+  AddToMixingBuffer(fPicoEvent);
 
   EventEnd(hbtEvent);  // cleanup for EbyE
   //cout << "AliFemtoSimpleAnalysis::ProcessEvent() - return to caller ... " << endl;
 }
 
+//_________________________
+AliFemtoPicoEvent* AliFemtoSimpleAnalysis::NewPicoEvent()
+{
+  /// Take a pico event from the recycled ones, or create a new one
+
+  if (fRecycledPicoEvents.empty()) {
+    return new AliFemtoPicoEvent;
+  }
+
+  AliFemtoPicoEvent *picoEvent = fRecycledPicoEvents.back();
+  fRecycledPicoEvents.pop_back();
+  picoEvent->Reset();
+  return picoEvent;
+}
+//_________________________
+void AliFemtoSimpleAnalysis::RecyclePicoEvent(AliFemtoPicoEvent* picoEvent)
+{
+  /// Keep the pico event for reuse in NewPicoEvent
+
+  fRecycledPicoEvents.push_back(picoEvent);
+}
+//_________________________
+void AliFemtoSimpleAnalysis::AddToMixingBuffer(AliFemtoPicoEvent* picoEvent)
+{
+  /// Insert the pico event at the front of the mixing buffer
+
+  AliFemtoPicoEventCollection *buffer = MixingBuffer();
+
+  if (!MixingBufferFull() || buffer->empty()) {
+    buffer->push_front(picoEvent);
+    return;
+  }
+
+  // buffer is full: rotate the last entry to the front and replace the oldest event
+  RecyclePicoEvent(buffer->back());
+  buffer->back() = picoEvent;
+  buffer->splice(buffer->begin(), *buffer, std::prev(buffer->end()));
+}
+//_________________________
+unsigned int AliFemtoSimpleAnalysis::MixingBufferParticleCount() const
+{
+  /// Count particles stored in the current mixing buffer
+
+  unsigned int count = 0;
+  for (auto &event : *fMixingBuffer) {
+    count += event->NumberOfParticles();
+  }
+  return count;
+}
 //_________________________
 void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
                                        AliFemtoParticleCollection *partCollection1,
@@ -16,6 +16,8 @@
 #include "AliFemtoV0SharedDaughterCut.h"
 #include "AliFemtoXiSharedDaughterCut.h"
 
+#include <vector>
+
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
 
@@ -40,6 +42,11 @@ class AliFemtoPicoEvent;
 /// - specify how many events are to be strored in the mixing buffer for
 ///  background construction
 ///
+/// The mixing buffer has a fixed capacity of NumEventsToMix events. Once it
+/// is full, the oldest event is rotated out and its pico event (with its
+/// particle collections) is recycled for one of the next events, so that a
+/// full buffer does not allocate any pico events or buffer entries.
+///
 /// Then, when the analysis is run, for each event, the EventBegin is
 /// called before any processing is done, then the ProcessEvent is called
 /// which takes care of creating real and mixed pairs and sending them
@@ -105,6 +112,9 @@ public:
   AliFemtoPicoEventCollection* MixingBuffer();
   bool MixingBufferFull();
 
+  /// Number of particles stored in all events of the mixing buffer
+  unsigned int MixingBufferParticleCount() const;
+
   /// Returns whether or not this analysis analyzes identical particles
   ///
   /// This implementation simply returns the equality of the two particle cut
@@ -159,6 +169,20 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Returns an empty pico event, reusing a recycled one if available
+  AliFemtoPicoEvent* NewPicoEvent();
+
+  /// Hand a pico event which is no longer needed back for reuse.
+  ///
+  /// The particles are only deleted when the event is reused, so the pico
+  /// event stays valid until the next call of NewPicoEvent.
+  void RecyclePicoEvent(AliFemtoPicoEvent* picoEvent);
+
+  /// Add fPicoEvent to the front of the mixing buffer. If the buffer is
+  /// full, the list entry of the oldest event is moved to the front and
+  /// reused, and the oldest event is recycled.
+  void AddToMixingBuffer(AliFemtoPicoEvent* picoEvent);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -168,6 +192,7 @@ protected:
   AliFemtoParticleCut*         fSecondParticleCut;   ///< select particles of type #2
   AliFemtoPicoEventCollection* fMixingBuffer;        ///< mixing buffer used in this simplest analysis
   AliFemtoPicoEvent*           fPicoEvent;           //!<! The current event, in the small (pico) form
+  std::vector<AliFemtoPicoEvent*> fRecycledPicoEvents; //!<! Pico events which left the mixing buffer, to be reused
 
   unsigned int fNumEventsToMix;                      ///< How many "previous" events get mixed with this one, to make background
   unsigned int fNeventsProcessed;                    ///< How many events processed so far
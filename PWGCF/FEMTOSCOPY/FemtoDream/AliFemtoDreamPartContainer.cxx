@@ -6,6 +6,7 @@
  */
 
 #include <iostream>
+#include <utility>
 #include "AliFemtoDreamPartContainer.h"
 #include "TLorentzVector.h"
 #include "TVector3.h"
@@ -44,11 +45,17 @@ AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 
 void AliFemtoDreamPartContainer::SetEvent(
     std::vector<AliFemtoDreamBasePart> &Particles) {
-  if (!(fPartBuffer.size() < fMixingDepth)) {
+  if (!fPartBuffer.empty() && !(fPartBuffer.size() < fMixingDepth)) {
 //    std::cout << "Popping Front" << std::endl;
+    //Reuse the storage of the oldest event, the assignment of the particles
+    //keeps the already allocated memory of their vector members
+    std::vector<AliFemtoDreamBasePart> oldest = std::move(fPartBuffer.front());
     fPartBuffer.pop_front();
+    oldest = Particles;
+    fPartBuffer.push_back(std::move(oldest));
+  } else {
+    fPartBuffer.push_back(Particles);
   }
-  fPartBuffer.push_back(Particles);
 //  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
 //      << Particles.size() << '\n';
   return;
@@ -72,3 +79,8 @@ std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
       .begin() + Depth;
   return *itEvt;
 }
+
+const std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
+    int Depth) const {
+  return fPartBuffer[Depth];
+}
@@ -24,11 +24,12 @@ class AliFemtoDreamPartContainer {
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
   void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
+  const std::deque<std::vector<AliFemtoDreamBasePart>> &GetEventBuffer() const {
     return fPartBuffer;
   }
   ;
   std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  const std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth) const;
   unsigned int GetMixingDepth() const {
     return fPartBuffer.size();
   }
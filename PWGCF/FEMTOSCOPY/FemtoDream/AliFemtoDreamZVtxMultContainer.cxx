@@ -15,7 +15,10 @@ ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
     : fPartContainer(0),
       fPDGParticleSpecies(0),
-      fWhichPairs(){
+      fWhichPairs(),
+      fSpeciesMass(),
+      fLorentzPart1(),
+      fLorentzPart2() {
 }
 
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
@@ -23,7 +26,10 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
     : fPartContainer(conf->GetNParticles(),
                      AliFemtoDreamPartContainer(conf->GetMixingDepth())),
       fPDGParticleSpecies(conf->GetPDGCodes()),
-      fWhichPairs(conf->GetWhichPairs()){
+      fWhichPairs(conf->GetWhichPairs()),
+      fSpeciesMass(),
+      fLorentzPart1(),
+      fLorentzPart2() {
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
@@ -56,44 +62,65 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
   }
   //  }
 }
+void AliFemtoDreamZVtxMultContainer::SetSpeciesMasses() {
+  //The PDG masses only need to be looked up once per species, and not for
+  //every pair
+  if (fSpeciesMass.size() == fPDGParticleSpecies.size()) {
+    return;
+  }
+  fSpeciesMass.clear();
+  for (auto itPDG : fPDGParticleSpecies) {
+    fSpeciesMass.push_back(TDatabasePDG::Instance()->GetParticle(itPDG)->Mass());
+  }
+}
+
+void AliFemtoDreamZVtxMultContainer::SetLorentzVectors(
+    const std::vector<AliFemtoDreamBasePart> &Particles, double mass,
+    std::vector<TLorentzVector> &Vectors) {
+  //Four momenta of one event are built once and stored contiguously, the
+  //pair loops then only read them
+  Vectors.resize(Particles.size());
+  auto itVec = Vectors.begin();
+  for (auto itPart = Particles.begin(); itPart != Particles.end();
+      ++itPart, ++itVec) {
+    TVector3 mom = itPart->GetMomentum();
+    itVec->SetXYZM(mom.X(), mom.Y(), mom.Z(), mass);
+  }
+}
+
 void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
   int HistCounter = 0;
+  SetSpeciesMasses();
   //First loop over all the different Species
   auto itPDGPar1 = fPDGParticleSpecies.begin();
   for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
       ++itSpec1) {
+    int iSpec1 = itSpec1 - Particles.begin();
+    SetLorentzVectors(*itSpec1, fSpeciesMass[iSpec1], fLorentzPart1);
     auto itPDGPar2 = fPDGParticleSpecies.begin();
-    itPDGPar2 += itSpec1 - Particles.begin();
+    itPDGPar2 += iSpec1;
     for (auto itSpec2 = itSpec1; itSpec2 != Particles.end(); ++itSpec2) {
       HigherMath->FillPairCounterSE(HistCounter, itSpec1->size(),
                                     itSpec2->size());
+      std::vector<TLorentzVector> &LorentzPart2 =
+          (itSpec1 == itSpec2) ? fLorentzPart1 : fLorentzPart2;
+      if (itSpec1 != itSpec2) {
+        SetLorentzVectors(*itSpec2,
+                          fSpeciesMass[itSpec2 - Particles.begin()],
+                          fLorentzPart2);
+      }
       //Now loop over the actual Particles and correlate them
-      for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-          ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
-        std::vector<AliFemtoDreamBasePart>::iterator itPart2;
-        if (itSpec1 == itSpec2) {
-          itPart2 = itPart1 + 1;
-        } else {
-          itPart2 = itSpec2->begin();
-        }
-        while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
-          TLorentzVector PartOne, PartTwo;
-          PartOne.SetXYZM(
-              itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-              itPart1->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-          PartTwo.SetXYZM(
-              itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-              itPart2->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-          float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
-          if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
+      for (size_t iPart1 = 0; iPart1 < itSpec1->size(); ++iPart1) {
+        AliFemtoDreamBasePart &part1 = (*itSpec1)[iPart1];
+        size_t iPart2 = (itSpec1 == itSpec2) ? iPart1 + 1 : 0;
+        for (; iPart2 < itSpec2->size(); ++iPart2) {
+          AliFemtoDreamBasePart &part2 = (*itSpec2)[iPart2];
+          float RelativeK = HigherMath->RelativePairMomentum(
+              fLorentzPart1[iPart1], LorentzPart2[iPart2]);
+          if (!HigherMath->PassesPairSelection(HistCounter, part1, part2,
                                                RelativeK, true, false)) {
-            ++itPart2;
             continue;
           }
           RelativeK = HigherMath->FillSameEvent(HistCounter, iMult, cent,
@@ -101,12 +128,11 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
                                                 *itPDGPar1,
                                                 part2,
                                                 *itPDGPar2);
-          HigherMath->MassQA(HistCounter, RelativeK, *itPart1, *itPart2);
-          HigherMath->SEDetaDPhiPlots(HistCounter, *itPart1, *itPDGPar1,
-                                      *itPart2, *itPDGPar2, RelativeK, false);
-          HigherMath->SEMomentumResolution(HistCounter, &(*itPart1), *itPDGPar1,
-                                           &(*itPart2), *itPDGPar2, RelativeK);
-          ++itPart2;
+          HigherMath->MassQA(HistCounter, RelativeK, part1, part2);
+          HigherMath->SEDetaDPhiPlots(HistCounter, part1, *itPDGPar1,
+                                      part2, *itPDGPar2, RelativeK, false);
+          HigherMath->SEMomentumResolution(HistCounter, &part1, *itPDGPar1,
+                                           &part2, *itPDGPar2, RelativeK);
         }
       }
       ++HistCounter;
@@ -120,6 +146,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
   int HistCounter = 0;
+  SetSpeciesMasses();
   auto itPDGPar1 = fPDGParticleSpecies.begin();
   //First loop over all the different Species
   for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
@@ -127,6 +154,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     //We dont want to correlate the particles twice. Mixed Event Dist. of
     //Particle1 + Particle2 == Particle2 + Particle 1
     int SkipPart = itSpec1 - Particles.begin();
+    SetLorentzVectors(*itSpec1, fSpeciesMass[SkipPart], fLorentzPart1);
     auto itPDGPar2 = fPDGParticleSpecies.begin() + SkipPart;
     for (auto itSpec2 = fPartContainer.begin() + SkipPart;
         itSpec2 != fPartContainer.end(); ++itSpec2) {
@@ -134,39 +162,36 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
         HigherMath->FillEffectiveMixingDepth(HistCounter,
                                              (int) itSpec2->GetMixingDepth());
       }
+      const double massPart2 = fSpeciesMass[itSpec2 - fPartContainer.begin()];
       for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
+        //The buffered event is used in place, and not copied
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = itSpec2->GetEvent(
             iDepth);
         HigherMath->FillPairCounterME(HistCounter, itSpec1->size(),
                                       ParticlesOfEvent.size());
-        for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-            ++itPart1) {
-          for (auto itPart2 = ParticlesOfEvent.begin();
-              itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-
-            TLorentzVector PartOne, PartTwo;
-            PartOne.SetXYZM(
-                itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-                itPart1->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-            PartTwo.SetXYZM(
-                itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-                itPart2->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-            float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
-            if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
+        if (itSpec1->size() == 0) {
+          continue;
+        }
+        SetLorentzVectors(ParticlesOfEvent, massPart2, fLorentzPart2);
+        for (size_t iPart1 = 0; iPart1 < itSpec1->size(); ++iPart1) {
+          AliFemtoDreamBasePart &part1 = (*itSpec1)[iPart1];
+          for (size_t iPart2 = 0; iPart2 < ParticlesOfEvent.size(); ++iPart2) {
+            AliFemtoDreamBasePart &part2 = ParticlesOfEvent[iPart2];
+            float RelativeK = HigherMath->RelativePairMomentum(
+                fLorentzPart1[iPart1], fLorentzPart2[iPart2]);
+            if (!HigherMath->PassesPairSelection(HistCounter, part1, part2,
                                                  RelativeK, false, false)) {
               continue;
             }
             RelativeK = HigherMath->FillMixedEvent(
-                HistCounter, iMult, cent, *itPart1, *itPDGPar1,
-                *itPart2, *itPDGPar2,
+                HistCounter, iMult, cent, part1, *itPDGPar1,
+                part2, *itPDGPar2,
                 AliFemtoDreamCollConfig::kNone);
 
-            HigherMath->MEDetaDPhiPlots(HistCounter, *itPart1, *itPDGPar1,
-                                        *itPart2, *itPDGPar2, RelativeK, false);
-            HigherMath->MEMomentumResolution(HistCounter, &(*itPart1),
-                                             *itPDGPar1, &(*itPart2),
+            HigherMath->MEDetaDPhiPlots(HistCounter, part1, *itPDGPar1,
+                                        part2, *itPDGPar2, RelativeK, false);
+            HigherMath->MEMomentumResolution(HistCounter, &part1,
+                                             *itPDGPar1, &part2,
                                              *itPDGPar2, RelativeK);
           }
         }
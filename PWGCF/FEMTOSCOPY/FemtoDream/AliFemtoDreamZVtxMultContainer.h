@@ -9,6 +9,7 @@
 #define ALIFEMTODREAMZVTXMULTCONTAINER_H_
 #include <vector>
 #include "Rtypes.h"
+#include "TLorentzVector.h"
 
 #include "AliFemtoDreamCollConfig.h"
 #include "AliFemtoDreamCorrHists.h"
@@ -41,9 +42,15 @@ class AliFemtoDreamZVtxMultContainer {
   }
   ;
  private:
+  void SetSpeciesMasses();
+  void SetLorentzVectors(const std::vector<AliFemtoDreamBasePart> &Particles,
+                         double mass, std::vector<TLorentzVector> &Vectors);
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
   std::vector<unsigned int> fWhichPairs;
+  std::vector<double> fSpeciesMass;          //! PDG mass per particle species
+  std::vector<TLorentzVector> fLorentzPart1; //! four momenta of the first species
+  std::vector<TLorentzVector> fLorentzPart2; //! four momenta of the second species
 //  std::vector<bool> fRejPairs;
 //  bool fDoDeltaEtaDeltaPhiCut;
 //  float fDeltaEtaMax;
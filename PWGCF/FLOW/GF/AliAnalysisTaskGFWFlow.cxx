@@ -424,10 +424,11 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
     //V_2{n}, full acceptance
     // mywatchStore.Start(kFALSE);
     Bool_t filled;
+    Int_t nProfBins = fPtAxis->GetNbins()+1;
     for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
       //Bool_t DisableOL=kFALSE;
       //if(l_ind<14) DisableOL = (l_ind%2); //Only for 1, 3, 5 ... 13
-      filled = FillFCs(corrconfigs.at(l_ind),cent,rndmn);//,DisableOL);
+      filled = FillFCs(corrconfigs.at(l_ind),&fCorrProfileBins[l_ind*nProfBins],cent,rndmn);//,DisableOL);
     };
     // mywatchStore.Stop();
     PostData(1,fFC);
@@ -620,14 +621,14 @@ Bool_t AliAnalysisTaskGFWFlow::FillFCs(TString head, TString hn, Double_t cent,
   };
   return kTRUE;
 };
-Bool_t AliAnalysisTaskGFWFlow::FillFCs(AliGFW::CorrConfig corconf, Double_t cent, Double_t rndmn, Bool_t DisableOverlap) {
+Bool_t AliAnalysisTaskGFWFlow::FillFCs(const AliGFW::CorrConfig &corconf, const Int_t *profBins, Double_t cent, Double_t rndmn, Bool_t DisableOverlap) {
   Double_t dnx, val;
   dnx = fGFW->Calculate(corconf,0,kTRUE).Re();
   if(dnx==0) return kFALSE;
   if(!corconf.pTDif) {
     val = fGFW->Calculate(corconf,0,kFALSE).Re()/dnx;
-    if(TMath::Abs(val)<1)
-      fFC->FillProfile(corconf.Head.Data(),cent,val,dnx,rndmn);
+    if(TMath::Abs(val)<1 && profBins[0])
+      fFC->FillProfile(profBins[0],cent,val,dnx,rndmn);
     return kTRUE;
   };
   /*Int_t binDisableOLFrom = fPtAxis->GetNbins()+1;
@@ -639,8 +640,8 @@ Bool_t AliAnalysisTaskGFWFlow::FillFCs(AliGFW::CorrConfig corconf, Double_t cent
     dnx = fGFW->Calculate(corconf,i-1,kTRUE,NeedToDisable).Re();
     if(dnx==0) continue;
     val = fGFW->Calculate(corconf,i-1,kFALSE,NeedToDisable).Re()/dnx;
-    if(TMath::Abs(val)<1)
-      fFC->FillProfile(Form("%s_pt_%i",corconf.Head.Data(),i),cent,val,dnx,rndmn);
+    if(TMath::Abs(val)<1 && profBins[i])
+      fFC->FillProfile(profBins[i],cent,val,dnx,rndmn);
   };
   return kTRUE;
 };
@@ -718,5 +719,13 @@ void AliAnalysisTaskGFWFlow::CreateCorrConfigs() {
   corrconfigs.push_back(GetConf("MidGapNV52","poiGapNeg refGapNeg | olGapNeg {5} refGapPos {-5}", kTRUE));
   corrconfigs.push_back(GetConf("MidGapPV52","refGapPos {5} refGapNeg {-5}", kFALSE));
   corrconfigs.push_back(GetConf("MidGapPV52","poiGapPos refGapPos | olGapPos {5} refGapNeg {-5}", kTRUE));
+  //Resolve the flow container bins once, instead of looking them up by name for each event
+  fCorrProfileBins.clear();
+  for(Int_t l_ind=0; l_ind<(Int_t)corrconfigs.size(); l_ind++) {
+    fCorrProfileBins.push_back(fFC->GetProfileIndex(corrconfigs.at(l_ind).Head.Data()));
+    for(Int_t i=1;i<=fPtAxis->GetNbins();i++)
+      fCorrProfileBins.push_back(corrconfigs.at(l_ind).pTDif?fFC->GetProfileIndex(Form("%s_pt_%i",corrconfigs.at(l_ind).Head.Data(),i)):0);
+    if(!fCorrProfileBins.at(fCorrProfileBins.size()-fPtAxis->GetNbins()-1)) printf("Could not find bin %s\n",corrconfigs.at(l_ind).Head.Data());
+  };
 
 }
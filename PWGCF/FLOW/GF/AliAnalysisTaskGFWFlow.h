@@ -54,6 +54,7 @@ class AliAnalysisTaskGFWFlow : public AliAnalysisTaskSE {
   void SetWeightDir(const char *newval) { fWeightDir.Clear(); fWeightDir.Append(newval); };
   Bool_t SetInputWeightList(TList *inList);
   vector<AliGFW::CorrConfig> corrconfigs; //! do not store
+  vector<Int_t> fCorrProfileBins; //! flow container bins of each correlator: integrated, then one per pt bin
   AliGFW::CorrConfig GetConf(TString head, TString desc, Bool_t ptdif) { return fGFW->GetCorrelatorConfig(desc,head,ptdif);};
   void CreateCorrConfigs();
   void SetTriggerType(AliVEvent::EOfflineTriggerTypes newval) { fTriggerType = newval; };
@@ -98,7 +99,7 @@ class AliAnalysisTaskGFWFlow : public AliAnalysisTaskSE {
   Bool_t AcceptParticle(AliVParticle *mPa);
   Bool_t InitRun();
   Bool_t LoadWeights(Int_t runno);
-  Bool_t FillFCs(AliGFW::CorrConfig corconf, Double_t cent, Double_t rndm, Bool_t DisableOverlap=kFALSE);
+  Bool_t FillFCs(const AliGFW::CorrConfig &corconf, const Int_t *profBins, Double_t cent, Double_t rndm, Bool_t DisableOverlap=kFALSE);
   Bool_t FillFCs(TString head, TString hn, Double_t cent, Bool_t diff, Double_t rndmn);
  // TStopwatch mywatch;
  // TStopwatch mywatchFill;
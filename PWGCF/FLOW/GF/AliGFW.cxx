@@ -78,13 +78,13 @@ Int_t AliGFW::CreateRegions() {
   //for(auto pitr = fRegions.begin(); pitr!=fRegions.end(); pitr++) pitr->PrintStructure();
   Int_t nRegions=0;
   for(auto pItr=fRegions.begin(); pItr!=fRegions.end(); pItr++) {
-    AliGFWCumulant *lCumulant = new AliGFWCumulant();
+    AliGFWCumulant lCumulant;
     if(pItr->NparVec.size()) {
-      lCumulant->CreateComplexVectorArrayVarPower(pItr->Nhar, pItr->NparVec, pItr->NpT);
+      lCumulant.CreateComplexVectorArrayVarPower(pItr->Nhar, pItr->NparVec, pItr->NpT);
     } else {
-      lCumulant->CreateComplexVectorArray(pItr->Nhar, pItr->Npar, pItr->NpT);
+      lCumulant.CreateComplexVectorArray(pItr->Nhar, pItr->Npar, pItr->NpT);
     };
-    fCumulants.push_back(*lCumulant);
+    fCumulants.push_back(lCumulant);
     ++nRegions;
   };
   if(nRegions) fInitialized=kTRUE;
@@ -131,42 +131,162 @@ TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGF
   };
   return formula;
 };
+Int_t AliGFW::CompilePlan(const vector<Int_t> &hars) {
+  //Unrolls the recursion of RecursiveCorr for given harmonics (all powers 1) into a list of nodes.
+  //Identical sub-terms, which the recursion evaluates many times, become one node.
+  if(hars.size()==0) return -1;
+  auto found = fPlanLookup.find(hars);
+  if(found!=fPlanLookup.end()) return found->second;
+  CorrPlan lPlan;
+  lPlan.FirstNode = fPlanNodes.size();
+  std::map<vector<Int_t>, Int_t> known;
+  CompileNode(hars, vector<Int_t>(hars.size(),1), known, lPlan.FirstNode);
+  lPlan.NNodes = fPlanNodes.size()-lPlan.FirstNode;
+  if((Int_t)fPlanValues.size()<lPlan.NNodes) fPlanValues.resize(lPlan.NNodes);
+  fPlans.push_back(lPlan);
+  fPlanLookup[hars] = fPlans.size()-1;
+  return fPlans.size()-1;
+};
+Int_t AliGFW::CompileNode(vector<Int_t> hars, vector<Int_t> pows, std::map<vector<Int_t>, Int_t> &known, Int_t firstNode) {
+  //Same structure as RecursiveCorr; returns the node index relative to the plan
+  vector<Int_t> key(hars);
+  key.insert(key.end(),pows.begin(),pows.end());
+  auto found = known.find(key);
+  if(found!=known.end()) return found->second;
+  CorrNode node;
+  node.Type = 0;
+  node.Har0 = hars.at(0);
+  node.Pow0 = pows.at(0);
+  node.Har1 = 0;
+  node.Pow1 = 0;
+  node.Child = -1;
+  node.SubFirst = 0;
+  node.SubLast = 0;
+  if(hars.size()==2) {
+    node.Type = 1;
+    node.Har1 = hars.at(1);
+    node.Pow1 = pows.at(1);
+  } else if(hars.size()>2) {
+    node.Type = 2;
+    node.Har1 = hars.at(hars.size()-1);
+    node.Pow1 = pows.at(pows.size()-1);
+    hars.erase(hars.end()-1);
+    pows.erase(pows.end()-1);
+    node.Child = CompileNode(hars, pows, known, firstNode);
+    vector<Int_t> lSub;
+    for(Int_t i=0;i<(Int_t)hars.size();i++) {
+      vector<Int_t> lhars = hars;
+      vector<Int_t> lpows = pows;
+      lhars.at(i)+=node.Har1;
+      lpows.at(i)+=node.Pow1;
+      lSub.push_back(CompileNode(lhars, lpows, known, firstNode));
+    };
+    node.SubFirst = fPlanSubtract.size();
+    fPlanSubtract.insert(fPlanSubtract.end(),lSub.begin(),lSub.end());
+    node.SubLast = fPlanSubtract.size();
+  };
+  fPlanNodes.push_back(node);
+  Int_t index = fPlanNodes.size()-1-firstNode;
+  known[key] = index;
+  return index;
+};
+std::complex<Double_t> AliGFW::EvaluatePlan(Int_t plan, AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin) {
+  //Evaluates the nodes in order; each term is calculated once
+  const CorrPlan &lPlan = fPlans[plan];
+  const CorrNode *nodes = &fPlanNodes[lPlan.FirstNode];
+  std::complex<Double_t> *vals = &fPlanValues[0];
+  for(Int_t i=0;i<lPlan.NNodes;i++) {
+    const CorrNode &node = nodes[i];
+    AliGFWCumulant *qp = ((node.Pow0!=1) && qol)?qol:qpoi; //as in RecursiveCorr
+    switch(node.Type) {
+      case 0:
+        vals[i] = qp->Val(node.Har0,node.Pow0,ptbin);
+        break;
+      case 1:
+        vals[i] = qp->Val(node.Har0,node.Pow0,ptbin)*qref->Val(node.Har1,node.Pow1,ptbin);
+        if(qol) vals[i]-=qol->Val(node.Har0+node.Har1,node.Pow0+node.Pow1,ptbin);
+        break;
+      default:
+        vals[i] = vals[node.Child]*qref->Val(node.Har1,node.Pow1);
+        for(Int_t j=node.SubFirst;j<node.SubLast;j++) vals[i]-=vals[fPlanSubtract[j]];
+        break;
+    };
+  };
+  return vals[lPlan.NNodes-1];
+};
+std::complex<Double_t> AliGFW::EvaluateCorrelator(const vector<Int_t> &hars, Int_t plan, Bool_t SetHarmsToZero, AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin) {
+  if(plan>-1) return EvaluatePlan(plan, qpoi, qref, qol, ptbin);
+  //Not compiled (configuration not created by GetCorrelatorConfig), use the recursion
+  vector<Int_t> lhars = hars;
+  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)lhars.size();i++) lhars.at(i) = 0;
+  TComplex val = RecursiveCorr(qpoi, qref, qol, ptbin, lhars);
+  return std::complex<Double_t>(val.Re(),val.Im());
+};
 void AliGFW::Clear() {
   for(auto ptr = fCumulants.begin(); ptr!=fCumulants.end(); ++ptr) ptr->ResetQs();
-  fCalculatedNames.clear();
-  fCalculatedQs.clear();
 };
 TComplex AliGFW::Calculate(TString config, Bool_t SetHarmsToZero) {
   if(config.EqualTo("")) {
     printf("Configuration empty!\n");
     return TComplex(0,0);
   };
+  //Parse the configuration only the first time it is seen
+  std::map<TString, std::pair<Int_t,Int_t>> &lConfigs = fStringConfigs[SetHarmsToZero?1:0];
+  auto found = lConfigs.find(config);
+  std::pair<Int_t,Int_t> range;
+  if(found!=lConfigs.end()) range = found->second;
+  else {
+    range = CompileStringConfig(config, SetHarmsToZero);
+    lConfigs[config] = range;
+  };
+  std::complex<Double_t> ret(1,0);
+  for(Int_t i=range.first;i<range.second;i++) {
+    const StringTerm &term = fStringTerms[i];
+    if(term.Plan<0) return TComplex(0,0);
+    AliGFWCumulant *qpoi = &fCumulants.at(term.Poi);
+    ret*=EvaluatePlan(term.Plan, qpoi, &fCumulants.at(term.Ref), qpoi, term.PtBin);
+  };
+  return TComplex(ret.real(),ret.imag());
+};
+std::pair<Int_t,Int_t> AliGFW::CompileStringConfig(TString config, Bool_t SetHarmsToZero) {
+  //Each {...} block becomes one term, evaluated as in CalculateSingle
+  std::pair<Int_t,Int_t> range(fStringTerms.size(),fStringTerms.size());
   TString tmp;
   Ssiz_t sz1=0;
-  TComplex ret(1,0);
   while(config.Tokenize(tmp,sz1,"}")) {
     if(SetHarmsToZero) SetHarmonicsToZero(tmp);
-    /*Int_t ind=FindCalculated(tmp);
-    if(ind>=0) {
-      ret*=fCalculatedQs.at(ind);
-      continue;
-    };*/
-    TComplex val=CalculateSingle(tmp);
-    ret*=val;
-    fCalculatedQs.push_back(val);
-    fCalculatedNames.push_back(tmp);
+    vector<Int_t> regs, hars;
+    StringTerm term;
+    term.Poi = 0;
+    term.Ref = 0;
+    term.PtBin = 0;
+    term.Plan = -1;
+    if(ParseSingle(tmp,regs,hars,term.PtBin) && regs.size()) {
+      term.Poi = regs.at(0);
+      term.Ref = (regs.size()==1)?regs.at(0):regs.at(1);
+      if(regs.size()==1) term.PtBin = 0;
+      term.Plan = CompilePlan(hars);
+    };
+    fStringTerms.push_back(term);
   };
-  return ret;
+  range.second = fStringTerms.size();
+  return range;
 };
 TComplex AliGFW::CalculateSingle(TString config) {
+  vector<Int_t> regs;
+  vector<Int_t> hars;
+  Int_t ptbin=0;
+  if(!ParseSingle(config,regs,hars,ptbin)) return TComplex(0,0);
+  if(regs.size()==1) return Calculate(regs.at(0),hars);
+  return Calculate(regs.at(0),regs.at(1),hars,ptbin);
+};
+Bool_t AliGFW::ParseSingle(TString config, vector<Int_t> &regs, vector<Int_t> &hars, Int_t &ptbin) {
   //First remove all ; and ,:
   config.ReplaceAll(","," ");
   config.ReplaceAll(";"," ");
   //Then make sure we don't have any double-spaces:
   while(config.Index("  ")>-1) config.ReplaceAll("  "," ");
-  vector<Int_t> regs;
-  vector<Int_t> hars;
-  Int_t ptbin=0;
+  ptbin=0;
   Ssiz_t sz1=0;
   Ssiz_t szend=0;
   TString ts, ts2;
@@ -179,7 +299,7 @@ TComplex AliGFW::CalculateSingle(TString config) {
   if(sz1<0) sz1=0;
   if(!config.Tokenize(ts,szend,"{")) {
     printf("Could not find harmonics!\n");
-    return TComplex(0,0);
+    return kFALSE;
   };
   //Fetch regions
   while(ts.Tokenize(ts2,sz1," ")) {
@@ -194,8 +314,7 @@ TComplex AliGFW::CalculateSingle(TString config) {
   };
   //Fetch harmonics
   while(config.Tokenize(ts,szend," ")) hars.push_back(ts.Atoi());
-  if(regs.size()==1) return Calculate(regs.at(0),hars);
-  return Calculate(regs.at(0),regs.at(1),hars,ptbin);
+  return kTRUE;
 };
 AliGFW::CorrConfig AliGFW::GetCorrelatorConfig(TString config, TString head, Bool_t ptdif) {
   //First remove all ; and ,:
@@ -260,6 +379,11 @@ AliGFW::CorrConfig AliGFW::GetCorrelatorConfig(TString config, TString head, Boo
   };
   ReturnConfig.Head = head;
   ReturnConfig.pTDif = ptdif;
+  //Compile the correlators, so that no recursion is needed when calculating
+  ReturnConfig.Plan = CompilePlan(ReturnConfig.Hars);
+  ReturnConfig.PlanZero = CompilePlan(vector<Int_t>(ReturnConfig.Hars.size(),0));
+  ReturnConfig.Plan2 = CompilePlan(ReturnConfig.Hars2);
+  ReturnConfig.Plan2Zero = CompilePlan(vector<Int_t>(ReturnConfig.Hars2.size(),0));
   return ReturnConfig;
 };
 
@@ -269,7 +393,7 @@ TComplex AliGFW::Calculate(Int_t poi, Int_t ref, vector<Int_t> hars, Int_t ptbin
   AliGFWCumulant *qovl = qpoi;
   return RecursiveCorr(qpoi, qref, qovl, ptbin, hars);
 };
-TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
+TComplex AliGFW::Calculate(const CorrConfig &corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
   if(corconf.Regs.size()==0) return TComplex(0,0);
   Int_t poi = corconf.Regs.at(0);
   Int_t ref = (corconf.Regs.size()>1)?corconf.Regs.at(1):corconf.Regs.at(0);
@@ -281,9 +405,8 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
   else if(ref==poi) qovl = qref; //If ref and poi are the same, then the same is for overlap. Only, when OL not explicitly defined
   if(!qpoi->IsPtBinFilled(ptbin)) return TComplex(0,0);
   //if(!qref->IsPtBinFilled(ptbin)) return TComplex(0,0);
-  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)corconf.Hars.size();i++) corconf.Hars.at(i) = 0;
-  TComplex retval = RecursiveCorr(qpoi, qref, qovl, ptbin, corconf.Hars);
-  if(corconf.Regs2.size()==0) return retval;
+  std::complex<Double_t> retval = EvaluateCorrelator(corconf.Hars, SetHarmsToZero?corconf.PlanZero:corconf.Plan, SetHarmsToZero, qpoi, qref, qovl, ptbin);
+  if(corconf.Regs2.size()==0) return TComplex(retval.real(),retval.imag());
   poi = corconf.Regs2.at(0);
   ref = (corconf.Regs2.size()>1)?corconf.Regs2.at(1):corconf.Regs2.at(0);
   qref = &fCumulants.at(ref);
@@ -291,9 +414,8 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
   if(corconf.Overlap2 > -1)
     qovl = DisableOverlap?0:(&fCumulants.at(corconf.Overlap2));//;DisableOverlap?0:qpoi;
   else if(ref==poi) qovl = qref; //Only when OL is not explicitly defined, then set it to ref/POI if they are the same
-  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)corconf.Hars2.size();i++) corconf.Hars2.at(i) = 0;
-  retval*=RecursiveCorr(qpoi, qref, qovl, 0, corconf.Hars2);
-  return retval;
+  retval*=EvaluateCorrelator(corconf.Hars2, SetHarmsToZero?corconf.Plan2Zero:corconf.Plan2, SetHarmsToZero, qpoi, qref, qovl, 0);
+  return TComplex(retval.real(),retval.imag());
 };
 
 TComplex AliGFW::Calculate(Int_t poi, vector<Int_t> hars) {
@@ -304,13 +426,6 @@ Int_t AliGFW::FindRegionByName(TString refName) {
   for(Int_t i=0;i<(Int_t)fRegions.size();i++) if(fRegions.at(i).rName.EqualTo(refName)) return i;
   return -1;
 };
-Int_t AliGFW::FindCalculated(TString identifier) {
-  if(fCalculatedNames.size()==0) return -1;
-  for(Int_t i=0;i<(Int_t)fCalculatedNames.size();i++) {
-    if(fCalculatedNames.at(i).EqualTo(identifier)) return i;
-  };
-  return -1;
-};
 Bool_t AliGFW::SetHarmonicsToZero(TString &instr) {
   TString tmp;
   Ssiz_t sz1=0, sz2;
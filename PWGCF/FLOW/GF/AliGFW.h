@@ -8,6 +8,8 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <complex>
+#include <map>
 #include "TString.h"
 #include "TObjArray.h"
 using std::vector;
@@ -46,6 +48,26 @@ class AliGFW {
     Int_t Overlap2=-1;
     Bool_t pTDif=kFALSE;
     TString Head="";
+    //Compiled plans (see CompilePlan), set by GetCorrelatorConfig. -1 = not compiled, evaluated recursively
+    Int_t Plan=-1;
+    Int_t PlanZero=-1; //with harmonics set to zero
+    Int_t Plan2=-1;
+    Int_t Plan2Zero=-1;
+  };
+  //One term of the recursive correlator formula, with fixed harmonics and powers
+  struct CorrNode {
+    Int_t Type; //0: single Q-vector, 1: two-particle term, 2: recursion step
+    Int_t Har0, Pow0; //harmonic and power of the first (POI) particle
+    Int_t Har1, Pow1; //type 1: second particle; type 2: last particle, multiplied from reference
+    Int_t Child; //type 2: node of the correlator without the last particle
+    Int_t SubFirst, SubLast; //type 2: range in fPlanSubtract of the nodes to subtract
+  };
+  struct CorrPlan {
+    Int_t FirstNode; //first node in fPlanNodes
+    Int_t NNodes; //nodes are ordered such that each one only depends on the previous ones; the last one is the result
+  };
+  struct StringTerm { //One {...} block of a string configuration
+    Int_t Poi, Ref, PtBin, Plan;
   };
   AliGFW();
   ~AliGFW();
@@ -60,7 +82,8 @@ class AliGFW {
   AliGFWCumulant GetCumulant(Int_t index) { return fCumulants.at(index); };
   TComplex Calculate(TString config, Bool_t SetHarmsToZero=kFALSE);
   CorrConfig GetCorrelatorConfig(TString config, TString head = "", Bool_t ptdif=kFALSE);
-  TComplex Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  TComplex Calculate(const CorrConfig &corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  Int_t CompilePlan(const vector<Int_t> &hars);
  private:
   Bool_t fInitialized;
   void SplitRegions();
@@ -71,14 +94,24 @@ class AliGFW {
   void AddRegion(Region inreg) { fRegions.push_back(inreg); };
   Region GetRegion(Int_t index) { return fRegions.at(index); };
   Int_t FindRegionByName(TString refName);
-  vector<TString> fCalculatedNames;
-  vector<TComplex> fCalculatedQs;
-  Int_t FindCalculated(TString identifier);
+  //Compiled correlators:
+  vector<CorrNode> fPlanNodes; //! nodes of all plans
+  vector<Int_t> fPlanSubtract; //! node indices (relative to the plan) subtracted in recursion steps
+  vector<CorrPlan> fPlans; //! compiled plans
+  std::map<vector<Int_t>, Int_t> fPlanLookup; //! harmonics -> plan, to share plans between configurations
+  vector<std::complex<Double_t>> fPlanValues; //! value of each node of the plan being evaluated
+  vector<StringTerm> fStringTerms; //! compiled string configurations
+  std::map<TString, std::pair<Int_t,Int_t>> fStringConfigs[2]; //! configuration -> range in fStringTerms; [1] for harmonics set to zero
+  Int_t CompileNode(vector<Int_t> hars, vector<Int_t> pows, std::map<vector<Int_t>, Int_t> &known, Int_t firstNode);
+  std::complex<Double_t> EvaluatePlan(Int_t plan, AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin);
+  std::complex<Double_t> EvaluateCorrelator(const vector<Int_t> &hars, Int_t plan, Bool_t SetHarmsToZero, AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin);
+  std::pair<Int_t,Int_t> CompileStringConfig(TString config, Bool_t SetHarmsToZero);
   //Calculateing functions:
   TComplex Calculate(Int_t poi, Int_t ref, vector<Int_t> hars, Int_t ptbin=0); //For differential, need POI and reference
   TComplex Calculate(Int_t poi, vector<Int_t> hars); //For integrated case
   //Process one string (= one region)
   TComplex CalculateSingle(TString config);
+  Bool_t ParseSingle(TString config, vector<Int_t> &regs, vector<Int_t> &hars, Int_t &ptbin);
 
   Bool_t SetHarmonicsToZero(TString &instr);
 
@@ -8,6 +8,8 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "TNamed.h"
 #include "TMath.h"
 #include "TAxis.h"
+#include <vector>
+#include <complex>
 using std::vector;
 class AliGFWCumulant {
  public:
@@ -20,22 +22,31 @@ class AliGFWCumulant {
   void Inc() { fNEntries++; };
   Int_t GetN() { return fNEntries; };
   // protected:
-  TComplex ***fQvector;
+  vector<std::complex<Double_t>> fQvector; //Q-vectors of all pt bins, harmonics and powers in one block, see QIndex()
   UInt_t fUsed;
   Int_t fNEntries;
   //Q-vectors. Could be done recursively, but maybe defining each one of them explicitly is easier to read
   TComplex Vec(Int_t, Int_t, Int_t ptbin=0); //envelope class to summarize pt-dif. Q-vec getter
+  std::complex<Double_t> Val(Int_t n, Int_t p, Int_t ptbin=0) const { //Same as Vec(), without the conversion to TComplex
+    if(!fInitialized) return 0;
+    if(ptbin>=fPt || ptbin<0) ptbin=0;
+    if(n>=0) return fQvector[QIndex(n,p,ptbin)];
+    return std::conj(fQvector[QIndex(-n,p,ptbin)]);
+  };
+  Int_t QIndex(Int_t n, Int_t p, Int_t ptbin) const { return ptbin*fPtStride + fPowOffset[n] + p; }; //No checks, n has to be >=0
   Int_t fN; //! Harmonics
   Int_t fPow; //! Power
   vector<Int_t> fPowVec; //! Powers array
+  vector<Int_t> fPowOffset; //! Position of the first power of each harmonic within one pt bin
+  Int_t fPtStride; //! Number of Q-vectors per pt bin
   Int_t fPt; //!fPt bins
-  Bool_t *fFilledPts;
+  vector<Bool_t> fFilledPts;
   Bool_t fInitialized; //Arrays are initialized
   void CreateComplexVectorArray(Int_t N=1, Int_t P=1, Int_t Pt=1);
   void CreateComplexVectorArrayVarPower(Int_t N=1, vector<Int_t> Pvec={1}, Int_t Pt=1);
   Int_t PW(Int_t ind) { return fPowVec.at(ind); }; //No checks to speed up, be carefull!!!
   void DestroyComplexVectorArray();
-  Bool_t IsPtBinFilled(Int_t ptb) { if(!fFilledPts) return kFALSE; return fFilledPts[ptb]; };
+  Bool_t IsPtBinFilled(Int_t ptb) { if(fFilledPts.empty()) return kFALSE; return fFilledPts[ptb]; };
 };
 
 #endif
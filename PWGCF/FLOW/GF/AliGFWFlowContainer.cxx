@@ -110,13 +110,21 @@ void AliGFWFlowContainer::SetXAxis() {
       delete tempax;
     }
 }
+Int_t AliGFWFlowContainer::GetProfileIndex(const char *hname) {
+  if(!fProf) return 0;
+  return fProf->GetYaxis()->FindBin(hname);
+};
 Int_t AliGFWFlowContainer::FillProfile(const char *hname, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
   if(!fProf) return -1;
-  Int_t yin = fProf->GetYaxis()->FindBin(hname);
+  Int_t yin = GetProfileIndex(hname);
   if(!yin) {
     printf("Could not find bin %s\n",hname);
     return -1;
   };
+  return FillProfile(yin,multi,corr,w,rn);
+};
+Int_t AliGFWFlowContainer::FillProfile(Int_t yin, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+  if(!fProf) return -1;
   fProf->Fill(multi,yin,corr,w);
   if(fNRandom) {
     Double_t rnind = rn*fNRandom;
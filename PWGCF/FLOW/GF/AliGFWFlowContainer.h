@@ -35,6 +35,8 @@ class AliGFWFlowContainer:public TNamed {
   Int_t GetNMultiBins() { return fProf->GetNbinsX(); };
   Double_t GetMultiAtBin(Int_t bin) { return fProf->GetXaxis()->GetBinCenter(bin); };
   Int_t FillProfile(const char *hname, Double_t multi, Double_t y, Double_t w, Double_t rn);
+  Int_t GetProfileIndex(const char *hname); //Bin of hname on the y axis, to be resolved once and used with FillProfile(Int_t, ...)
+  Int_t FillProfile(Int_t yin, Double_t multi, Double_t y, Double_t w, Double_t rn);
   TProfile2D *GetProfile() { return fProf; };
   void OverrideProfileErrors(TProfile2D *inpf);
   void ReadAndMerge(const char *infile);
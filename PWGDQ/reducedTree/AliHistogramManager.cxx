@@ -49,7 +49,14 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlanReady(kFALSE),
+  fPlanHist(),
+  fPlanType(),
+  fPlanVarW(),
+  fPlanVarOffset(),
+  fPlanVars(),
+  fClassPlanOffset()
 {
   //
   // Constructor
@@ -71,7 +78,14 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlanReady(kFALSE),
+  fPlanHist(),
+  fPlanType(),
+  fPlanVarW(),
+  fPlanVarOffset(),
+  fPlanVars(),
+  fClassPlanOffset()
 {
   //
   // Constructor
@@ -131,6 +145,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillPlanReady = kFALSE;
 }
 
 //_________________________________________________________________
@@ -145,6 +160,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a histogram
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanReady = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -287,6 +303,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a histogram
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanReady = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -432,6 +449,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a multi-dimensional histogram THnF or THnFSparseF
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanReady = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -485,6 +503,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a multi-dimensional histogram THnF or THnSparseF with equal or variable bin widths
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanReady = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -620,150 +639,265 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+void AliHistogramManager::CompileFillPlan() {
   //
-  //  fill a class of histograms
+  // Decode the UniqueID encoding of all histograms into a flat list of fill instructions.
+  // Histograms with variables which are not in use are never filled and are left out of the plan.
+  // The UniqueID of each histogram class list is set to its index in the plan.
+  // Called automatically on the first fill after histograms or classes were added.
   //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
-  }
-  if(!hList) {
-    return;
-  }
-    
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
+  fPlanHist.clear();
+  fPlanType.clear();
+  fPlanVarW.clear();
+  fPlanVarOffset.clear();
+  fPlanVars.clear();
+  fClassPlanOffset.clear();
+  fPlanVarOffset.push_back(0);
+  
   Int_t uid = 0;
   Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
   Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
+  Int_t thnDim=0;
+  Bool_t isProfile, isTHn;
+  for(Int_t iclass=0; iclass<fMainList.GetEntries(); ++iclass) {
+    THashList* hList = (THashList*)fMainList.At(iclass);
+    hList->SetUniqueID(iclass);
+    fClassPlanOffset.push_back(fPlanHist.size());
+    
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      uid = h->GetUniqueID();
+      isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
+      if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
+      dimension = 0;
+      if(!isTHn) dimension = ((TH1*)h)->GetDimension();
+      
+      uid = (uid-(uid%100))/100;
+      varX = -1;
+      varY = -1;
+      varZ = -1;
+      varT = -1;
+      varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) continue;
+      
+      Int_t type = -1;
+      Int_t nVarsBefore = fPlanVars.size();
+      if(!isTHn) {
+        varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
+        fPlanVars.push_back(varX);
         switch(dimension) {
           case 1:
+            type = kFillTH1;
             if(isProfile) {
+              type = kFillProfile;
               varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
+              fPlanVars.push_back(varY);
             }
           break;
           case 2:
+            type = kFillTH2;
             varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
+            fPlanVars.push_back(varY);
             if(isProfile) {
+              type = kFillProfile2D;
               varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
+              fPlanVars.push_back(varZ);
             }
           break;
           case 3:
+            type = kFillTH3;
             varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
             varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
+            fPlanVars.push_back(varY);
+            fPlanVars.push_back(varZ);
             if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
+              type = kFillProfile3D;
+              fPlanVars.push_back(varT);
             }
           break;
           default:
           break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
         }
       }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
+      else {
+        type = kFillTHn;
+        for(Int_t idim=0;idim<thnDim;++idim) 
+          fPlanVars.push_back(((THnBase*)h)->GetAxis(idim)->GetUniqueID());
+      }
+      
+      Bool_t allVarsGood = (type>=0);
+      for(Int_t ivar=nVarsBefore; ivar<(Int_t)fPlanVars.size(); ++ivar) 
+        allVarsGood &= fUsedVars[fPlanVars[ivar]];
+      if(!allVarsGood) {
+        fPlanVars.resize(nVarsBefore);
+        continue;
+      }
+      
+      fPlanHist.push_back(h);
+      fPlanType.push_back(type);
+      fPlanVarW.push_back(varW);
+      fPlanVarOffset.push_back(fPlanVars.size());
+    }
+  }
+  fClassPlanOffset.push_back(fPlanHist.size());
+  fFillPlanReady = kTRUE;
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassIndex(const Char_t* className) {
+  //
+  // Index of a histogram class in the fill plan, -1 if the class does not exist
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  if(!fFillPlanReady) CompileFillPlan();
+  return hList->GetUniqueID();
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  Int_t classIndex = GetHistClassIndex(className);
+  if(classIndex<0) {
+    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
+    cout << "         Histogram list not filled" << endl; */
+    return;
+  }
+  ExecuteFillPlan(classIndex, values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t** values, Int_t nEntries) {
+  //
+  //  fill a class of histograms with nEntries value vectors
+  //
+  Int_t classIndex = GetHistClassIndex(className);
+  if(classIndex<0) return;
+  FillHistClass(classIndex, values, nEntries);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIndex, Float_t* values) {
+  //
+  //  fill a class of histograms, the index is given by GetHistClassIndex()
+  //
+  if(!fFillPlanReady) CompileFillPlan();
+  if(classIndex<0 || classIndex>=(Int_t)fClassPlanOffset.size()-1) return;
+  ExecuteFillPlan(classIndex, values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIndex, Float_t** values, Int_t nEntries) {
+  //
+  //  fill a class of histograms with nEntries value vectors, the index is given by GetHistClassIndex()
+  //  The entries are filled histogram by histogram, in the order in which they are given
+  //
+  if(!fFillPlanReady) CompileFillPlan();
+  if(classIndex<0 || classIndex>=(Int_t)fClassPlanOffset.size()-1) return;
+  
+  Double_t fillValues[20]={0.0};
+  for(Int_t i=fClassPlanOffset[classIndex]; i<fClassPlanOffset[classIndex+1]; ++i) {
+    TObject* h = fPlanHist[i];
+    const Int_t* vars = &fPlanVars[0] + fPlanVarOffset[i];
+    Int_t varW = fPlanVarW[i];
+    Bool_t isWeighted = (varW>AliReducedVarManager::kNothing);
+    switch(fPlanType[i]) {
+      case kFillTH1:
+        if(isWeighted) for(Int_t ie=0;ie<nEntries;++ie) ((TH1F*)h)->Fill(values[ie][vars[0]],values[ie][varW]);
+        else           for(Int_t ie=0;ie<nEntries;++ie) ((TH1F*)h)->Fill(values[ie][vars[0]]);
+      break;
+      case kFillProfile:
+        if(isWeighted) for(Int_t ie=0;ie<nEntries;++ie) ((TProfile*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][varW]);
+        else           for(Int_t ie=0;ie<nEntries;++ie) ((TProfile*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]]);
+      break;
+      case kFillTH2:
+        if(isWeighted) for(Int_t ie=0;ie<nEntries;++ie) ((TH2F*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][varW]);
+        else           for(Int_t ie=0;ie<nEntries;++ie) ((TH2F*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]]);
+      break;
+      case kFillProfile2D:
+        if(isWeighted) for(Int_t ie=0;ie<nEntries;++ie) ((TProfile2D*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][vars[2]],values[ie][varW]);
+        else           for(Int_t ie=0;ie<nEntries;++ie) ((TProfile2D*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][vars[2]]);
+      break;
+      case kFillTH3:
+        if(isWeighted) for(Int_t ie=0;ie<nEntries;++ie) ((TH3F*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][vars[2]],values[ie][varW]);
+        else           for(Int_t ie=0;ie<nEntries;++ie) ((TH3F*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][vars[2]]);
+      break;
+      case kFillProfile3D:
+        if(isWeighted) for(Int_t ie=0;ie<nEntries;++ie) ((TProfile3D*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][vars[2]],values[ie][vars[3]],values[ie][varW]);
+        else           for(Int_t ie=0;ie<nEntries;++ie) ((TProfile3D*)h)->Fill(values[ie][vars[0]],values[ie][vars[1]],values[ie][vars[2]],values[ie][vars[3]]);
+      break;
+      case kFillTHn:
+        {
+          Int_t nDim = fPlanVarOffset[i+1]-fPlanVarOffset[i];
+          for(Int_t ie=0;ie<nEntries;++ie) {
+            for(Int_t idim=0;idim<nDim;++idim) fillValues[idim] = values[ie][vars[idim]];
+            if(isWeighted) ((THnBase*)h)->Fill(fillValues,values[ie][varW]);
+            else           ((THnBase*)h)->Fill(fillValues);
           }
         }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
+      break;
+      default:
+      break;
+    }
+  }
+}
+
+//__________________________________________________________________
+void AliHistogramManager::ExecuteFillPlan(Int_t classIndex, Float_t* values) {
+  //
+  //  fill one value vector into the histograms of a class, following the fill plan
+  //
+  Double_t fillValues[20]={0.0};
+  for(Int_t i=fClassPlanOffset[classIndex]; i<fClassPlanOffset[classIndex+1]; ++i) {
+    TObject* h = fPlanHist[i];
+    const Int_t* vars = &fPlanVars[0] + fPlanVarOffset[i];
+    Int_t varW = fPlanVarW[i];
+    Bool_t isWeighted = (varW>AliReducedVarManager::kNothing);
+    switch(fPlanType[i]) {
+      case kFillTH1:
+        if(isWeighted) ((TH1F*)h)->Fill(values[vars[0]],values[varW]);
+        else           ((TH1F*)h)->Fill(values[vars[0]]);
+      break;
+      case kFillProfile:
+        if(isWeighted) ((TProfile*)h)->Fill(values[vars[0]],values[vars[1]],values[varW]);
+        else           ((TProfile*)h)->Fill(values[vars[0]],values[vars[1]]);
+      break;
+      case kFillTH2:
+        if(isWeighted) ((TH2F*)h)->Fill(values[vars[0]],values[vars[1]],values[varW]);
+        else           ((TH2F*)h)->Fill(values[vars[0]],values[vars[1]]);
+      break;
+      case kFillProfile2D:
+        if(isWeighted) ((TProfile2D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[varW]);
+        else           ((TProfile2D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+      break;
+      case kFillTH3:
+        if(isWeighted) ((TH3F*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[varW]);
+        else           ((TH3F*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+      break;
+      case kFillProfile3D:
+        if(isWeighted) ((TProfile3D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]],values[varW]);
+        else           ((TProfile3D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]]);
+      break;
+      case kFillTHn:
+        {
+          Int_t nDim = fPlanVarOffset[i+1]-fPlanVarOffset[i];
+          for(Int_t idim=0;idim<nDim;++idim) fillValues[idim] = values[vars[idim]];
+          if(isWeighted) ((THnBase*)h)->Fill(fillValues,values[varW]);
+          else           ((THnBase*)h)->Fill(fillValues);
         }
-      }
+      break;
+      default:
+      break;
     }
   }
 }
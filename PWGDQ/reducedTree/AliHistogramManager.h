@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +71,11 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(const Char_t* className, Float_t** values, Int_t nEntries);   // fill nEntries value vectors at once
+  void FillHistClass(Int_t classIndex, Float_t* values);
+  void FillHistClass(Int_t classIndex, Float_t** values, Int_t nEntries);
+  Int_t GetHistClassIndex(const Char_t* className);    // index to be used with the fast FillHistClass() overloads, -1 if not found
+  void CompileFillPlan();
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,9 +113,24 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plan: the histograms of all classes, decoded once from the UniqueID encoding into a flat list of fill instructions
+  enum EFillType {
+    kFillTH1=0, kFillTH2, kFillTH3, 
+    kFillProfile, kFillProfile2D, kFillProfile3D,
+    kFillTHn
+  };
+  Bool_t fFillPlanReady;                 //! the fill plan is up to date with the histogram lists
+  std::vector<TObject*> fPlanHist;       //! target histogram of each instruction
+  std::vector<Int_t> fPlanType;          //! EFillType of each instruction
+  std::vector<Int_t> fPlanVarW;          //! weight variable of each instruction, kNothing if not weighted
+  std::vector<Int_t> fPlanVarOffset;     //! first variable of each instruction in fPlanVars (n instructions + 1 entries)
+  std::vector<Int_t> fPlanVars;          //! variables of all instructions, in fill order (X,Y,Z,T or THn axes)
+  std::vector<Int_t> fClassPlanOffset;   //! first instruction of each class in fMainList (n classes + 1 entries)
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  void ExecuteFillPlan(Int_t classIndex, Float_t* values);
   
-  ClassDef(AliHistogramManager, 4)
+  ClassDef(AliHistogramManager, 5)
 };
 
 #endif
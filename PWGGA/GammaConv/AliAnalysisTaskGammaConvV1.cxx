@@ -353,7 +353,11 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL),
-  fFileWasAlreadyReported(kFALSE)
+  fFileWasAlreadyReported(kFALSE),
+  fPhotonCutSetGroup(),
+  fPhotonSelectionTable(),
+  fNPhotonCutSetGroups(0),
+  fPhotonCutsCache(NULL)
 {
 
 }
@@ -652,7 +656,11 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL),
-  fFileWasAlreadyReported(kFALSE)
+  fFileWasAlreadyReported(kFALSE),
+  fPhotonCutSetGroup(),
+  fPhotonSelectionTable(),
+  fNPhotonCutSetGroups(0),
+  fPhotonCutsCache(NULL)
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -668,6 +676,10 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
 
 AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
 {
+  if(fPhotonCutsCache){
+    delete fPhotonCutsCache;
+    fPhotonCutsCache = 0x0;
+  }
   if(fGammaCandidates){
     delete fGammaCandidates;
     fGammaCandidates = 0x0;
@@ -2337,6 +2349,9 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fPhotonCutSetGroup.empty()) CompilePhotonCutSets();
+  fPhotonCutsCache->Reset();
+  fPhotonSelectionTable.assign(fReaderGammas->GetEntriesFast()*fNPhotonCutSetGroups, 0);
 
   // ------------------- BeginEvent ----------------------------
 
@@ -2592,8 +2607,7 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
     }
 
 
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
+    if(!IsPhotonSelectedByCutSet(PhotonCandidate,i)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
       !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
       fGammaCandidates->Add(PhotonCandidate); // if no second loop is required add to events good gammas
@@ -5068,44 +5082,32 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
   if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseRotationMethod()){
 
     for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-      AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+      const AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
       for(Int_t iCurrent2=iCurrent+1;iCurrent2<fGammaCandidates->GetEntries();iCurrent2++){
+        const AliAODConversionPhoton *currentEventGoodV02Orig = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
         for(Int_t nRandom=0;nRandom<((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->GetNumberOfBGEvents();nRandom++){
-        AliAODConversionPhoton currentEventGoodV02 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
 
         if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoBGProbability()){
-          AliAODConversionMother *backgroundCandidateProb = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-          Double_t massBGprob = backgroundCandidateProb->M();
+          // only the pair mass is needed here, no mother candidate
+          Double_t massBGprob = PairInvariantMass(currentEventGoodV0,currentEventGoodV02Orig);
           if(massBGprob>0.1 && massBGprob<0.14){
             if(fRandom.Rndm()>fBGHandler[fiCut]->GetBGProb(zbin,mbin)){
-              delete backgroundCandidateProb;
               continue;
             }
           }
-          delete backgroundCandidateProb;
-          backgroundCandidateProb = 0x0;
         }
 
+        AliAODConversionPhoton currentEventGoodV02 = *currentEventGoodV02Orig;
         RotateParticle(&currentEventGoodV02);
-        AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-        backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-        if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-          ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-          if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-          else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-          if(fDoTHnSparse){
-            Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-            if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-            else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-          }
-        }
-        delete backgroundCandidate;
-        backgroundCandidate = 0x0;
+        AliAODConversionMother backgroundCandidate(currentEventGoodV0,&currentEventGoodV02);
+        FillCombinatorialBackground(&backgroundCandidate,zbin,mbin,kFALSE);
         }
       }
     }
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
+    // photons of the pool event, moved and rotated once per pool event instead of once per pair
+    std::vector<AliAODConversionPhoton> previousEventGoodV0s;
 
     if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
       for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
@@ -5114,31 +5116,12 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
 
+        PrepareBackgroundEventPhotons(previousEventV0s,bgEventVertex,previousEventGoodV0s);
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-        AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-          if(fMoveParticleAccordingToVertex == kTRUE){
-            MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-          }
-          if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-            RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-          }
-
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-            if(fDoTHnSparse){
-              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-              if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-              else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-            }
-          }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
+        const AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+        for(UInt_t iPrevious=0;iPrevious<previousEventGoodV0s.size();iPrevious++){
+          AliAODConversionMother backgroundCandidate(currentEventGoodV0,&previousEventGoodV0s[iPrevious]);
+          FillCombinatorialBackground(&backgroundCandidate,zbin,mbin,kFALSE);
         }
         }
       }
@@ -5149,42 +5132,12 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
+        PrepareBackgroundEventPhotons(previousEventV0s,bgEventVertex,previousEventGoodV0s);
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-
-            if(fMoveParticleAccordingToVertex == kTRUE){
-              MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-            }
-            if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-              RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-            }
-
-
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-            if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-              ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-              if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-              else{
-                  if(!fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-                  if(fDoJetAnalysis){
-                  if(fConvJetReader->GetNJets() > 0){
-                    if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-                    else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-                  }
-                }
-              }
-              if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-                else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-              }
-            }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
+          const AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+          for(UInt_t iPrevious=0;iPrevious<previousEventGoodV0s.size();iPrevious++){
+            AliAODConversionMother backgroundCandidate(currentEventGoodV0,&previousEventGoodV0s[iPrevious]);
+            FillCombinatorialBackground(&backgroundCandidate,zbin,mbin,kTRUE);
           }
         }
         }
@@ -5243,25 +5196,30 @@ void AliAnalysisTaskGammaConvV1::CalculateBackgroundSwapp(){
               lvRotationPhoton1.Rotate(rotationAngle, lvRotationPion);
               lvRotationPhoton2.Rotate(rotationAngle, lvRotationPion);
             }
-            std::unique_ptr<AliAODConversionPhoton> currentEventGoodV0Rotation1 (new AliAODConversionPhoton(&lvRotationPhoton1));
-            std::unique_ptr<AliAODConversionPhoton> currentEventGoodV0Rotation2 (new AliAODConversionPhoton(&lvRotationPhoton2));
+            AliAODConversionPhoton currentEventGoodV0Rotation1(&lvRotationPhoton1);
+            AliAODConversionPhoton currentEventGoodV0Rotation2(&lvRotationPhoton2);
+            // the eta acceptance of the swapped photons does not depend on the partner,
+            // mother candidates are only built for the photons passing it
+            Bool_t acceptRotation1 = fabs(currentEventGoodV0Temp1->Eta()) <= ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetEtaCut();
+            Bool_t acceptRotation2 = fabs(currentEventGoodV0Temp2->Eta()) <= ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetEtaCut();
+            if(!acceptRotation1 && !acceptRotation2) continue;
             for(auto kCurrentGammaCandidates  : *fGammaCandidates){
               if(currentEventGoodV0Temp1 == ((AliAODConversionPhoton*) kCurrentGammaCandidates) || currentEventGoodV0Temp2 == ((AliAODConversionPhoton*) kCurrentGammaCandidates)) continue;
 
-              std::unique_ptr<AliAODConversionMother> backgroundCandidate1(new AliAODConversionMother(currentEventGoodV0Rotation1.get(), ((AliAODConversionPhoton*) kCurrentGammaCandidates)));
-              std::unique_ptr<AliAODConversionMother> backgroundCandidate2(new AliAODConversionMother(currentEventGoodV0Rotation2.get(), ((AliAODConversionPhoton*) kCurrentGammaCandidates)));
-              if( fabs(currentEventGoodV0Temp1->Eta()) <= ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetEtaCut())
+              if(acceptRotation1)
               {
-                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate1.get(),kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))
+                AliAODConversionMother backgroundCandidate1(&currentEventGoodV0Rotation1, ((AliAODConversionPhoton*) kCurrentGammaCandidates));
+                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(&backgroundCandidate1,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))
                 {
-                  vSwappingInvMassPT.push_back({backgroundCandidate1->M(),backgroundCandidate1->Pt()});
+                  vSwappingInvMassPT.push_back({backgroundCandidate1.M(),backgroundCandidate1.Pt()});
                 }
               }
-              if( fabs(currentEventGoodV0Temp2->Eta()) <= ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetEtaCut())
+              if(acceptRotation2)
               {
-                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate2.get(),kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))
+                AliAODConversionMother backgroundCandidate2(&currentEventGoodV0Rotation2, ((AliAODConversionPhoton*) kCurrentGammaCandidates));
+                if(((AliConversionMesonCuts*) fMesonCutArray->At(fiCut))->MesonIsSelected(&backgroundCandidate2,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))
                 {
-                  vSwappingInvMassPT.push_back({backgroundCandidate2->M(),backgroundCandidate2->Pt()});
+                  vSwappingInvMassPT.push_back({backgroundCandidate2.M(),backgroundCandidate2.Pt()});
                 }
               }
             }
@@ -5398,6 +5356,101 @@ void AliAnalysisTaskGammaConvV1::MoveParticleAccordingToVertex(AliAODConversionP
   particle->SetConversionPoint(movedPlace);
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::PrepareBackgroundEventPhotons(const AliGammaConversionAODVector *previousEventV0s, const AliGammaConversionAODBGHandler::GammaConversionVertex *vertex, std::vector<AliAODConversionPhoton> &photons){
+  // copy the photons of a pool event once and apply the vertex/event plane
+  // transformation, they are then combined with all photons of the current event
+  photons.clear();
+  if(!previousEventV0s) return;
+  photons.reserve(previousEventV0s->size());
+  for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+    photons.push_back(*(previousEventV0s->at(iPrevious)));
+    if(fMoveParticleAccordingToVertex == kTRUE){
+      MoveParticleAccordingToVertex(&photons.back(),vertex);
+    }
+    if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+      RotateParticleAccordingToEP(&photons.back(),vertex->fEP,fEventPlaneAngle);
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::FillCombinatorialBackground(AliAODConversionMother *backgroundCandidate, Int_t zbin, Int_t mbin, Bool_t fillJetHistos){
+  backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+  if(!((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
+    ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift())) return;
+
+  if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+  else if(!fillJetHistos) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
+  else{
+    if(!fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
+    if(fDoJetAnalysis){
+      if(fConvJetReader->GetNJets() > 0){
+        if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
+        else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
+      }
+    }
+  }
+  if(fDoTHnSparse){
+    Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+    if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
+    else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
+  }
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskGammaConvV1::PairInvariantMass(const AliAODConversionPhoton *gamma0, const AliAODConversionPhoton *gamma1){
+  // same four-momentum sum as in the AliAODConversionMother constructor
+  TLorentzVector pair(gamma0->Px()+gamma1->Px(),gamma0->Py()+gamma1->Py(),gamma0->Pz()+gamma1->Pz(),gamma0->E()+gamma1->E());
+  return pair.M();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::CompilePhotonCutSets(){
+  // group the cut sets with equivalent photon selection, such that the photon
+  // selection is evaluated once per photon and group instead of once per cut set,
+  // and let all photon cut objects share the inputs of their sub-cuts
+  if(!fPhotonCutsCache) fPhotonCutsCache = new AliConversionPhotonCutsCache();
+  fPhotonCutSetGroup.assign(fnCuts, -1);
+  std::vector<Int_t> groupOfCut(fnCuts, -1);
+  fNPhotonCutSetGroups = 0;
+  for(Int_t iCut = 0; iCut<fnCuts; iCut++){
+    AliConversionPhotonCuts *photonCuts = (AliConversionPhotonCuts*)fCutArray->At(iCut);
+    photonCuts->SetPhotonCutsCache(fPhotonCutsCache);
+    for(Int_t jCut = 0; jCut<iCut; jCut++){
+      if(fPhotonCutSetGroup[jCut] != jCut) continue;
+      if(photonCuts->HasSameSelection((AliConversionPhotonCuts*)fCutArray->At(jCut))){
+        fPhotonCutSetGroup[iCut] = jCut;
+        groupOfCut[iCut] = groupOfCut[jCut];
+        break;
+      }
+    }
+    if(fPhotonCutSetGroup[iCut] < 0){
+      fPhotonCutSetGroup[iCut] = iCut;
+      groupOfCut[iCut] = fNPhotonCutSetGroups++;
+    }
+  }
+  // from here on the table maps each cut set directly to its photon cut group
+  fPhotonCutSetGroup = groupOfCut;
+  AliInfo(Form("%d cut sets use %d distinct photon selections", fnCuts, fNPhotonCutSetGroups));
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskGammaConvV1::IsPhotonSelectedByCutSet(AliAODConversionPhoton *photon, Int_t iPhoton){
+  // photon selection (PhotonIsSelected and in-plane/out-of-plane cut) of the current cut set,
+  // reusing the decision of an equivalent cut set evaluated earlier in the event. Cut sets
+  // filling cut histograms run their own selection to fill them, the expensive inputs
+  // of the sub-cuts are taken from the cache shared by all cut objects
+  Char_t &decision = fPhotonSelectionTable[iPhoton*fNPhotonCutSetGroups + fPhotonCutSetGroup[fiCut]];
+  AliConversionPhotonCuts *photonCuts = (AliConversionPhotonCuts*)fCutArray->At(fiCut);
+  if(decision == 0 || photonCuts->GetCutHistograms()){
+    Bool_t selected = photonCuts->PhotonIsSelected(photon,fInputEvent) &&
+                      photonCuts->InPlaneOutOfPlaneCut(photon->GetPhotonPhi(),fEventPlaneAngle);
+    decision = selected ? 1 : -1;
+  }
+  return decision > 0;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::UpdateEventByEventData(){
   //see header file for documentation
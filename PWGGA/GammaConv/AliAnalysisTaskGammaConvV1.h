@@ -84,6 +84,11 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void FillPhotonCombinatorialMothersHistESD(TParticle *daughter,TParticle *mother);
     void FillPhotonCombinatorialMothersHistAOD(AliAODMCParticle *daughter, AliAODMCParticle* motherCombPart);
     void MoveParticleAccordingToVertex(AliAODConversionPhoton* particle,const AliGammaConversionAODBGHandler::GammaConversionVertex *vertex);
+    void CompilePhotonCutSets();
+    Bool_t IsPhotonSelectedByCutSet(AliAODConversionPhoton *photon, Int_t iPhoton);
+    void PrepareBackgroundEventPhotons(const AliGammaConversionAODVector *previousEventV0s, const AliGammaConversionAODBGHandler::GammaConversionVertex *vertex, std::vector<AliAODConversionPhoton> &photons);
+    void FillCombinatorialBackground(AliAODConversionMother *backgroundCandidate, Int_t zbin, Int_t mbin, Bool_t fillJetHistos);
+    static Double_t PairInvariantMass(const AliAODConversionPhoton *gamma0, const AliAODConversionPhoton *gamma1);
     void UpdateEventByEventData();
     void SetLogBinningXTH2(TH2* histoRebin);
     Int_t GetSourceClassification(Int_t daughter, Int_t pdgCode);
@@ -404,12 +409,16 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     TTree*                            tBrokenFiles;                               // tree for keeping track of broken files
     TObjString*                       fFileNameBroken;                            // string object for broken file name
     Bool_t                            fFileWasAlreadyReported;                    // to store if the current file was already marked broken 
+    std::vector<Int_t>                fPhotonCutSetGroup;                         //! index of the first cut set with an equivalent photon selection
+    std::vector<Char_t>               fPhotonSelectionTable;                      //! per photon and photon cut group: 0 not evaluated, 1 selected, -1 rejected
+    Int_t                             fNPhotonCutSetGroups;                       //! number of distinct photon selections
+    AliConversionPhotonCutsCache*     fPhotonCutsCache;                           //! per-event inputs of the photon sub-cuts shared by all photon cut objects
 
   private:
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 49);
+    ClassDef(AliAnalysisTaskGammaConvV1, 50);
 };
 
 #endif
@@ -33,9 +33,11 @@
 
 #include "TAxis.h"
 #include "TChain.h"
+#include "TClonesArray.h"
 #include "TH1F.h"
 #include "TF1.h"
 
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <utility>
@@ -59,11 +61,22 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fRunNumber(-1),
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
-  fMapTrackToCluster(),
-  fMapClusterToTrack(),
-  fNEntries(1),
+  fMatchTrackPos(),
+  fMatchTrackID(),
+  fMatchClusterID(),
   fVectorDeltaEtaDeltaPhi(0),
-  fMap_TrID_ClID_ToIndex(),
+  fTrackRowKeyMin(0),
+  fTrackRowOffsets(),
+  fTrackRows(),
+  fClusterRowKeyMin(0),
+  fClusterRowOffsets(),
+  fClusterRows(),
+  fMatchSortBuffer(),
+  fClusterIndex(),
+  fClusterPos(),
+  fClusterGrid(),
+  fClusterCandidates(),
+  fClusterGridSize(0),
   fSecMapTrackToCluster(),
   fSecMapClusterToTrack(),
   fSecNEntries(1),
@@ -85,10 +98,14 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
 //________________________________________________________________________
 AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     // default deconstructor
-    fMapTrackToCluster.clear();
-    fMapClusterToTrack.clear();
+    fMatchTrackPos.clear();
+    fMatchTrackID.clear();
+    fMatchClusterID.clear();
     fVectorDeltaEtaDeltaPhi.clear();
-    fMap_TrID_ClID_ToIndex.clear();
+    fTrackRowOffsets.clear();
+    fTrackRows.clear();
+    fClusterRowOffsets.clear();
+    fClusterRows.clear();
 
     fSecMapTrackToCluster.clear();
     fSecMapClusterToTrack.clear();
@@ -107,10 +124,14 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::Terminate(Option_t *){
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
+  fMatchTrackPos.clear();
+  fMatchTrackID.clear();
+  fMatchClusterID.clear();
   fVectorDeltaEtaDeltaPhi.clear();
-  fMap_TrID_ClID_ToIndex.clear();
+  fTrackRowOffsets.clear();
+  fTrackRows.clear();
+  fClusterRowOffsets.clear();
+  fClusterRows.clear();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -166,11 +187,15 @@ void AliCaloTrackMatcher::UserCreateOutputObjects(){
 //________________________________________________________________________
 void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   // Initialize function to be called once before analysis
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
-  fNEntries = 1;
+  // the match table only gets cleared, the vectors keep their capacity from event to event
+  fMatchTrackPos.clear();
+  fMatchTrackID.clear();
+  fMatchClusterID.clear();
   fVectorDeltaEtaDeltaPhi.clear();
-  fMap_TrID_ClID_ToIndex.clear();
+  fTrackRowOffsets.clear();
+  fTrackRows.clear();
+  fClusterRowOffsets.clear();
+  fClusterRows.clear();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -286,6 +311,9 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     }
   }
 
+  // cache position of all clusters once per event, each track then only visits the clusters around it
+  FillClusterGrid(event, arrClusters, nClus);
+
   for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){
     AliExternalTrackParam *trackParam = 0;
     AliVTrack *inTrack = 0x0;
@@ -434,51 +462,30 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     // cout << "eta/phi: " << eta << ", " << phi << endl;
     // cout << "nClus: " << nClus << endl;
     Int_t nClusterMatchesToTrack = 0;
-    for(Int_t iclus=0;iclus < nClus;iclus++){
-      AliVCluster* cluster = NULL;
-      if(arrClusters){
-        if(esdev){
-          if(arrClusters)
-            cluster = new AliESDCaloCluster(*(AliESDCaloCluster*)arrClusters->At(iclus));
-        } else if(aodev){
-          if(arrClusters)
-            cluster = new AliAODCaloCluster(*(AliAODCaloCluster*)arrClusters->At(iclus));
-        }
-      }
-      else
-        cluster = event->GetCaloCluster(iclus);
-      if (!cluster){
-        if(arrClusters) delete cluster;
-        continue;
-      }
-      // cout << "-------------------------LOOPING: " << iclus << ", " << cluster->GetID() << endl;
-      cluster->GetPosition(clsPos);
+    FillClusterCandidates(exPos);
+    for(UInt_t iCand=0;iCand < fClusterCandidates.size();iCand++){
+      Int_t iCache = fClusterCandidates.at(iCand);
+      clsPos[0] = fClusterPos.at(3*iCache);
+      clsPos[1] = fClusterPos.at(3*iCache+1);
+      clsPos[2] = fClusterPos.at(3*iCache+2);
       Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
       //cout << "dR: " << dR << endl;
-      if (dR > fMatchingWindow){
-        if(arrClusters) delete cluster;
-        continue;
-      }
+      if (dR > fMatchingWindow) continue;
+
+      AliVCluster* cluster = NULL;
+      if(arrClusters) cluster = (AliVCluster*)arrClusters->At(fClusterIndex.at(iCache));
+      else cluster = event->GetCaloCluster(fClusterIndex.at(iCache));
+      // cout << "-------------------------LOOPING: " << fClusterIndex.at(iCache) << ", " << cluster->GetID() << endl;
       Double_t clusterR = TMath::Sqrt( clsPos[0]*clsPos[0] + clsPos[1]*clsPos[1] );
       AliExternalTrackParam trackParamTmp(emcParam);//Retrieve the starting point every time before the extrapolation
       if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
-        if (!cluster->IsEMCAL()){
-          if(arrClusters) delete cluster;
-          continue;
-        }
         if(!AliEMCALRecoUtils::ExtrapolateTrackToCluster(&trackParamTmp, cluster, 0.139, 5., dEta, dPhi)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(arrClusters) delete cluster;
           continue;
         }
       }else if(fClusterType == 2){
-        if (!cluster->IsPHOS()){
-          if(arrClusters) delete cluster;
-          continue;
-        }
         if(!AliTrackerBase::PropagateTrackToBxByBz(&trackParamTmp, clusterR, 0.139, 5., kTRUE, 0.8, -1)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(arrClusters) delete cluster;
           continue;
         }
         Double_t trkPos[3] = {0,0,0};
@@ -492,31 +499,159 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       Float_t dR2 = dPhi*dPhi + dEta*dEta;
 
       //cout << dEta << " - " << dPhi << " - " << dR2 << endl;
-      if(dR2 > fMatchingResidual){
-        if(arrClusters) delete cluster;
-        continue;
-      }
+      if(dR2 > fMatchingResidual) continue;
       nClusterMatchesToTrack++;
-      if(aodev){
-        fMapTrackToCluster.insert(make_pair(itr,cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),itr));
-      }else{
-        fMapTrackToCluster.insert(make_pair(inTrack->GetID(),cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),inTrack->GetID()));
-      }
+      if(aodev) fMatchTrackPos.push_back(itr);
+      else fMatchTrackPos.push_back(inTrack->GetID());
+      fMatchTrackID.push_back(inTrack->GetID());
+      fMatchClusterID.push_back(cluster->GetID());
       fVectorDeltaEtaDeltaPhi.push_back(make_pair(dEta,dPhi));
-      fMap_TrID_ClID_ToIndex[make_pair(inTrack->GetID(),cluster->GetID())] = fNEntries++;
-      if( (Int_t)fVectorDeltaEtaDeltaPhi.size() != (fNEntries-1)) AliFatal("Fatal error in AliCaloTrackMatcher, vector and map are not in sync!");
-      if(arrClusters) delete cluster;
     }
     if(nClusterMatchesToTrack == 0) FillfHistControlMatches(5.,inTrack->Pt());
     else FillfHistControlMatches(6.,inTrack->Pt());
     delete trackParam;
   }
 
+  BuildMatchIndex(fMatchTrackID, fTrackRowKeyMin, fTrackRowOffsets, fTrackRows);
+  BuildMatchIndex(fMatchClusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows);
+
   return;
 }
 
+//________________________________________________________________________
+void AliCaloTrackMatcher::FillClusterGrid(AliVEvent *event, TClonesArray *arrClusters, Int_t nClus){
+  // keep only clusters of the calorimeter the matcher is running on, together with their position
+  fClusterIndex.clear();
+  fClusterPos.clear();
+  fClusterGrid.clear();
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    AliVCluster* cluster = NULL;
+    if(arrClusters) cluster = (AliVCluster*)arrClusters->At(iclus);
+    else cluster = event->GetCaloCluster(iclus);
+    if(!cluster) continue;
+    if((fClusterType == 1 || fClusterType == 3 || fClusterType == 4) && !cluster->IsEMCAL()) continue;
+    if(fClusterType == 2 && !cluster->IsPHOS()) continue;
+    Float_t clsPos[3] = {0.,0.,0.};
+    cluster->GetPosition(clsPos);
+    fClusterIndex.push_back(iclus);
+    fClusterPos.push_back(clsPos[0]);
+    fClusterPos.push_back(clsPos[1]);
+    fClusterPos.push_back(clsPos[2]);
+  }
+
+  // cells are slightly larger than the matching window, such that every cluster within the window
+  // of a track is found in the 27 cells around the track independent of rounding
+  fClusterGridSize = 0;
+  if(fMatchingWindow < 0.01) return;
+  fClusterGridSize = 1.001*fMatchingWindow;
+  for(UInt_t iCache=0;iCache < fClusterIndex.size();iCache++)
+    fClusterGrid.push_back(make_pair(GetClusterGridCell(fClusterPos.at(3*iCache),fClusterPos.at(3*iCache+1),fClusterPos.at(3*iCache+2)),(Int_t)iCache));
+  sort(fClusterGrid.begin(),fClusterGrid.end());
+}
+
+//________________________________________________________________________
+Long64_t AliCaloTrackMatcher::GetClusterGridCell(Double_t x, Double_t y, Double_t z, Int_t dx, Int_t dy, Int_t dz) const {
+  // pack the cell coordinates into one key, 21 bits each
+  const Long64_t offset = 1 << 20;
+  Long64_t cell[3] = { (Long64_t)TMath::Floor(x/fClusterGridSize) + dx,
+                       (Long64_t)TMath::Floor(y/fClusterGridSize) + dy,
+                       (Long64_t)TMath::Floor(z/fClusterGridSize) + dz };
+  Long64_t key = 0;
+  for(Int_t i = 0; i < 3; i++){
+    if(cell[i] < -offset) cell[i] = -offset;
+    if(cell[i] > offset-1) cell[i] = offset-1;
+    key = (key << 21) | (cell[i] + offset);
+  }
+  return key;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::FillClusterCandidates(const Double_t *exPos){
+  // collect the clusters in the cells around the extrapolated track position in increasing cluster order
+  fClusterCandidates.clear();
+  if(fClusterGridSize <= 0){
+    for(UInt_t iCache=0;iCache < fClusterIndex.size();iCache++) fClusterCandidates.push_back(iCache);
+    return;
+  }
+  for(Int_t dx = -1; dx <= 1; dx++){
+    for(Int_t dy = -1; dy <= 1; dy++){
+      for(Int_t dz = -1; dz <= 1; dz++){
+        Long64_t cell = GetClusterGridCell(exPos[0],exPos[1],exPos[2],dx,dy,dz);
+        vector< pair<Long64_t,Int_t> >::const_iterator it = lower_bound(fClusterGrid.begin(),fClusterGrid.end(),make_pair(cell,-1));
+        for(; it != fClusterGrid.end() && it->first == cell; ++it) fClusterCandidates.push_back(it->second);
+      }
+    }
+  }
+  sort(fClusterCandidates.begin(),fClusterCandidates.end());
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::BuildMatchIndex(const vector<Int_t> &keys, Int_t &keyMin, vector<Int_t> &offsets, vector<Int_t> &rows){
+  // sort the matches by key, keeping the order of finding for equal keys, and store the
+  // offset of each row if the keys are dense enough for a direct lookup
+  Int_t nMatches = keys.size();
+  rows.resize(nMatches);
+  offsets.clear();
+  keyMin = 0;
+  if(nMatches == 0) return;
+
+  keyMin = *min_element(keys.begin(),keys.end());
+  Long64_t nKeys = (Long64_t)*max_element(keys.begin(),keys.end()) - keyMin + 1;
+  if(nKeys <= 4*(Long64_t)nMatches + 1024){
+    offsets.assign(nKeys+1,0);
+    for(Int_t i = 0; i < nMatches; i++) offsets[keys[i]-keyMin+1]++;
+    for(Long64_t k = 0; k < nKeys; k++) offsets[k+1] += offsets[k];
+    for(Int_t i = 0; i < nMatches; i++) rows[offsets[keys[i]-keyMin]++] = i;
+    for(Long64_t k = nKeys; k > 0; k--) offsets[k] = offsets[k-1];
+    offsets[0] = 0;
+  }else{
+    fMatchSortBuffer.clear();
+    for(Int_t i = 0; i < nMatches; i++) fMatchSortBuffer.push_back(make_pair(keys[i],i));
+    sort(fMatchSortBuffer.begin(),fMatchSortBuffer.end());
+    for(Int_t i = 0; i < nMatches; i++) rows[i] = fMatchSortBuffer[i].second;
+  }
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::GetMatchRow(Int_t key, Int_t keyMin, const vector<Int_t> &offsets, const vector<Int_t> &rows, const vector<Int_t> &keys, Int_t &first, Int_t &last) const {
+  // range [first,last) in rows of all matches with the given key
+  first = 0;
+  last = 0;
+  if(rows.empty()) return;
+  if(!offsets.empty()){
+    Long64_t k = (Long64_t)key - keyMin;
+    if(k < 0 || k >= (Long64_t)offsets.size()-1) return;
+    first = offsets[k];
+    last = offsets[k+1];
+    return;
+  }
+  Int_t lo = 0, hi = rows.size();
+  while(lo < hi){
+    Int_t mid = (lo+hi)/2;
+    if(keys[rows[mid]] < key) lo = mid+1;
+    else hi = mid;
+  }
+  first = lo;
+  hi = rows.size();
+  while(lo < hi){
+    Int_t mid = (lo+hi)/2;
+    if(keys[rows[mid]] <= key) lo = mid+1;
+    else hi = mid;
+  }
+  last = lo;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedTrackRow(AliVEvent *event, Int_t trackID, Int_t &first, Int_t &last) const {
+  // position of the track in the event and range of its matches in fTrackRows
+  GetMatchRow(trackID, fTrackRowKeyMin, fTrackRowOffsets, fTrackRows, fMatchTrackID, first, last);
+  if(event->IsA()==AliAODEvent::Class()){ // for AOD, the position of the track in the event is stored with its matches
+    if(first == last) return -1;
+    return fMatchTrackPos.at(fTrackRows.at(first));
+  }
+  return trackID; // for ESD just take trackID
+}
+
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi){
 
@@ -746,10 +881,15 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
+  Int_t first, last;
+  GetMatchRow(trackID, fTrackRowKeyMin, fTrackRowOffsets, fTrackRows, fMatchTrackID, first, last);
+  Int_t position = -1;
+  for (Int_t iRow = first; iRow < last; iRow++){
+    if(fMatchClusterID.at(fTrackRows.at(iRow)) == clusterID) position = fTrackRows.at(iRow);
+  }
+  if(position == -1) return kFALSE;
 
-  pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(position-1);
+  pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(position);
   dEta = tempEtaPhi.first;
   dPhi = tempEtaPhi.second;
   return kTRUE;
@@ -757,21 +897,20 @@ Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
-      }
+  Int_t first, last;
+  GetMatchRow(clusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows, fMatchClusterID, first, last);
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fClusterRows.at(iRow);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos.at(iMatch)));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+    Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+    if(tempTrack->Charge()>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+    }else if(tempTrack->Charge()<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
     }
   }
 
@@ -781,24 +920,23 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
-    }
+  Int_t first, last;
+  GetMatchRow(clusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows, fMatchClusterID, first, last);
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fClusterRows.at(iRow);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos.at(iMatch)));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+    Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+
+    if (match_dPhi && match_dEta )matched++;
   }
   return matched;
 }
@@ -806,16 +944,15 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
-    }
+  Int_t first, last;
+  GetMatchRow(clusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows, fMatchClusterID, first, last);
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fClusterRows.at(iRow);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos.at(iMatch)));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+    Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
   }
   return matched;
 }
@@ -823,33 +960,24 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
 
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t first, last;
+  Int_t TrackPos = GetMatchedTrackRow(event, trackID, first, last);
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
+  if(TrackPos == -1) return matched;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fTrackRows.at(iRow);
+    if(fMatchTrackPos.at(iMatch) == TrackPos){
+      Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+      Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -858,37 +986,28 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t first, last;
+  Int_t TrackPos = GetMatchedTrackRow(event, trackID, first, last);
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
+  if(TrackPos == -1) return matched;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fTrackRows.at(iRow);
+    if(fMatchTrackPos.at(iMatch) == TrackPos){
+      Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+      Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
   return matched;
@@ -896,28 +1015,19 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t first, last;
+  Int_t TrackPos = GetMatchedTrackRow(event, trackID, first, last);
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
+  if(TrackPos == -1) return matched;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fTrackRows.at(iRow);
+    if(fMatchTrackPos.at(iMatch) == TrackPos){
+      Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+      Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -926,21 +1036,20 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
-      }
+  Int_t first, last;
+  GetMatchRow(clusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows, fMatchClusterID, first, last);
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fClusterRows.at(iRow);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos.at(iMatch)));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+    Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+    if(tempTrack->Charge()>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(fMatchTrackPos.at(iMatch));
+    }else if(tempTrack->Charge()<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(fMatchTrackPos.at(iMatch));
     }
   }
   return tempMatchedTracks;
@@ -949,25 +1058,24 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
+  Int_t first, last;
+  GetMatchRow(clusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows, fMatchClusterID, first, last);
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fClusterRows.at(iRow);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos.at(iMatch)));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+    Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+
+    if (match_dPhi && match_dEta )tempMatchedTracks.push_back(fMatchTrackPos.at(iMatch));
 
-      }
-    }
   }
   return tempMatchedTracks;
 }
@@ -975,49 +1083,39 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
-    }
+  Int_t first, last;
+  GetMatchRow(clusterID, fClusterRowKeyMin, fClusterRowOffsets, fClusterRows, fMatchClusterID, first, last);
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fClusterRows.at(iRow);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos.at(iMatch)));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+    Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(fMatchTrackPos.at(iMatch));
   }
   return tempMatchedTracks;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t first, last;
+  Int_t TrackPos = GetMatchedTrackRow(event, trackID, first, last);
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
+  if(TrackPos == -1) return tempMatchedClusters;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fTrackRows.at(iRow);
+    if(fMatchTrackPos.at(iMatch) == TrackPos){
+      Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+      Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(fMatchClusterID.at(iMatch));
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(fMatchClusterID.at(iMatch));
       }
     }
   }
@@ -1027,36 +1125,27 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t first, last;
+  Int_t TrackPos = GetMatchedTrackRow(event, trackID, first, last);
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
+  if(TrackPos == -1) return tempMatchedClusters;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fTrackRows.at(iRow);
+    if(fMatchTrackPos.at(iMatch) == TrackPos){
+      Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+      Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(fMatchClusterID.at(iMatch));
     }
   }
   return tempMatchedClusters;
@@ -1064,28 +1153,19 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t first, last;
+  Int_t TrackPos = GetMatchedTrackRow(event, trackID, first, last);
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
+  if(TrackPos == -1) return tempMatchedClusters;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  for (Int_t iRow = first; iRow < last; iRow++){
+    Int_t iMatch = fTrackRows.at(iRow);
+    if(fMatchTrackPos.at(iMatch) == TrackPos){
+      Float_t tempDEta = fVectorDeltaEtaDeltaPhi.at(iMatch).first;
+      Float_t tempDPhi = fVectorDeltaEtaDeltaPhi.at(iMatch).second;
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(fMatchClusterID.at(iMatch));
     }
   }
   return tempMatchedClusters;
@@ -1097,8 +1177,9 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetSecTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fSecMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
+  mapT::const_iterator iter = fSecMap_TrID_ClID_ToIndex.find(make_pair(trackID,clusterID));
+  if(iter == fSecMap_TrID_ClID_ToIndex.end() || iter->second == 0) return kFALSE;
+  Int_t position = iter->second;
 
   pairFloat tempEtaPhi = fSecVectorDeltaEtaDeltaPhi.at(position-1);
   dEta = tempEtaPhi.first;
@@ -1107,27 +1188,26 @@ Bool_t AliCaloTrackMatcher::GetSecTrackClusterMatchingResidual(Int_t trackID, In
 }
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t clusterID){
-  Int_t position = fSecMap_TrID_ClID_AlreadyTried[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
+  mapT::const_iterator iter = fSecMap_TrID_ClID_AlreadyTried.find(make_pair(trackID,clusterID));
+  if(iter == fSecMap_TrID_ClID_AlreadyTried.end() || iter->second == 0) return kFALSE;
   else return kTRUE;
 }
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -1139,22 +1219,21 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )matched++;
     }
   }
 
@@ -1165,14 +1244,13 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
 
@@ -1197,17 +1275,16 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -1233,21 +1310,20 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
 
@@ -1272,12 +1348,11 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
 
@@ -1288,19 +1363,18 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
       }
     }
   }
@@ -1312,22 +1386,21 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
     }
   }
 
@@ -1338,14 +1411,13 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
     }
   }
 
@@ -1370,17 +1442,16 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
       }
     }
   }
@@ -1406,20 +1477,19 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
     }
   }
 
@@ -1444,12 +1514,11 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
     }
   }
 
@@ -1535,12 +1604,9 @@ void AliCaloTrackMatcher::DebugMatching(){
     cout << "NEW EVENT !" << endl;
     cout << "vector etaphi:" << endl;
     cout << fVectorDeltaEtaDeltaPhi.size() << endl;
-    cout << "multimap" << endl;
-    mapT::iterator iter = fMap_TrID_ClID_ToIndex.begin();
-    for (iter = fMap_TrID_ClID_ToIndex.begin(); iter != fMap_TrID_ClID_ToIndex.end(); ++iter){
-      Float_t dEta, dPhi = 0;
-      if(!GetTrackClusterMatchingResidual(iter->first.first,iter->first.second,dEta,dPhi)) continue;
-      cout << "  [" << iter->first.first << "/" << iter->first.second << ", " << iter->second << "] - (" << dEta << "/" << dPhi << ")" << endl;
+    cout << "match table" << endl;
+    for (UInt_t iMatch = 0; iMatch < fVectorDeltaEtaDeltaPhi.size(); iMatch++){
+      cout << "  [" << fMatchTrackID.at(iMatch) << "/" << fMatchClusterID.at(iMatch) << ", " << iMatch << "] - (" << fVectorDeltaEtaDeltaPhi.at(iMatch).first << "/" << fVectorDeltaEtaDeltaPhi.at(iMatch).second << ")" << endl;
     }
     cout << "mapTrackToCluster" << endl;
     AliESDEvent *esdev = dynamic_cast<AliESDEvent*>(fInputEvent);
@@ -1553,11 +1619,10 @@ void AliCaloTrackMatcher::DebugMatching(){
       cout << itr << " (" << tCharge << ") - " << GetNMatchedClusterIDsForTrack(fInputEvent,inTrack->GetID(),5,-5,0.2,-0.4) << "\t\t";
     }
     cout << endl;
-    multimap<Int_t,Int_t>::iterator it;
-    for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    for (UInt_t iRow = 0; iRow < fTrackRows.size(); iRow++) cout << fMatchTrackID.at(fTrackRows.at(iRow)) << " => " << fMatchClusterID.at(fTrackRows.at(iRow)) << '\n';
     cout << "mapClusterToTrack" << endl;
-    Int_t tempClus = it->second;
-    for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    Int_t tempClus = fMatchClusterID.back();
+    for (UInt_t iRow = 0; iRow < fClusterRows.size(); iRow++) cout << fMatchClusterID.at(fClusterRows.at(iRow)) << " => " << fMatchTrackPos.at(fClusterRows.at(iRow)) << '\n';
     vector<Int_t> tempTracks = GetMatchedTrackIDsForCluster(fInputEvent,tempClus, 5, -5, 0.2, -0.4);
     for(UInt_t iJ=0; iJ<tempTracks.size();iJ++){
       cout << tempClus << " - " << tempTracks.at(iJ) << endl;
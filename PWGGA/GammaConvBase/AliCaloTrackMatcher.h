@@ -9,6 +9,7 @@
 #include <utility>
 
 class TF1;
+class TClonesArray;
 
 using namespace std;
 
@@ -91,6 +92,14 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
 
+    // per event match table
+    void FillClusterGrid(AliVEvent *event, TClonesArray *arrClusters, Int_t nClus);
+    void FillClusterCandidates(const Double_t *exPos);
+    Long64_t GetClusterGridCell(Double_t x, Double_t y, Double_t z, Int_t dx = 0, Int_t dy = 0, Int_t dz = 0) const;
+    void BuildMatchIndex(const vector<Int_t> &keys, Int_t &keyMin, vector<Int_t> &offsets, vector<Int_t> &rows);
+    void GetMatchRow(Int_t key, Int_t keyMin, const vector<Int_t> &offsets, const vector<Int_t> &rows, const vector<Int_t> &keys, Int_t &first, Int_t &last) const;
+    Int_t GetMatchedTrackRow(AliVEvent *event, Int_t trackID, Int_t &first, Int_t &last) const;
+
     // debug methods
     void DebugMatching();
     void DebugV0Matching();
@@ -115,12 +124,25 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     AliEMCALGeometry*     fGeomEMCAL;              // pointer to EMCAL geometry
     AliPHOSGeometry*      fGeomPHOS;               // pointer to PHOS geometry
 
-    multimap<Int_t,Int_t> fMapTrackToCluster;      // connects a given track ID with all associated cluster IDs
-    multimap<Int_t,Int_t> fMapClusterToTrack;      // connects a given cluster ID with all associated track IDs
-
-    Int_t                 fNEntries;               // number of current TrackID/ClusterID -> Eta/Phi connections
-    vector<pairFloat>     fVectorDeltaEtaDeltaPhi; // vector of all matching residuals for a specific TrackID/ClusterID
-    mapT                  fMap_TrID_ClID_ToIndex;  // map tuple of (trackID,clusterID) to index in vector fVectorDeltaEtaDeltaPhi
+    // flat table of all track <-> cluster matches of the current event, one entry per match in order of finding
+    vector<Int_t>         fMatchTrackPos;          //! position of the track in the event (AOD) or track ID (ESD)
+    vector<Int_t>         fMatchTrackID;           //! track ID
+    vector<Int_t>         fMatchClusterID;         //! cluster ID
+    vector<pairFloat>     fVectorDeltaEtaDeltaPhi; //! matching residuals (dEta,dPhi)
+    // compressed rows of the match table per track ID and per cluster ID, rebuilt after each event
+    Int_t                 fTrackRowKeyMin;         //! smallest track ID with a match
+    vector<Int_t>         fTrackRowOffsets;        //! offsets of the rows in fTrackRows per track ID, empty if IDs are too sparse
+    vector<Int_t>         fTrackRows;              //! match indices sorted by track ID
+    Int_t                 fClusterRowKeyMin;       //! smallest cluster ID with a match
+    vector<Int_t>         fClusterRowOffsets;      //! offsets of the rows in fClusterRows per cluster ID, empty if IDs are too sparse
+    vector<Int_t>         fClusterRows;            //! match indices sorted by cluster ID
+    vector<pairInt>       fMatchSortBuffer;        //! (key, match index) buffer for sparse keys
+    // calorimeter clusters of the current event, sorted into cells of the size of the matching window
+    vector<Int_t>         fClusterIndex;           //! index of the cluster in the event/cluster array
+    vector<Float_t>       fClusterPos;             //! cluster positions (x,y,z)
+    vector< pair<Long64_t,Int_t> > fClusterGrid;   //! (grid cell, cluster) sorted by cell
+    vector<Int_t>         fClusterCandidates;      //! clusters in the cells around the current track
+    Double_t              fClusterGridSize;        //! edge length of a grid cell, <= 0 if the grid is not used
 
     // for cluster <-> V0-track matching (running with different mass hypthesis)
     multimap<Int_t,Int_t> fSecMapTrackToCluster;      // connects a given secondary track ID with all associated cluster IDs
@@ -138,7 +160,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
 
     Bool_t                fDoLightOutput;       // switch for running light output, kFALSE -> normal mode, kTRUE -> light mode
 
-    ClassDef(AliCaloTrackMatcher,7)
+    ClassDef(AliCaloTrackMatcher,8)
 };
 
 #endif
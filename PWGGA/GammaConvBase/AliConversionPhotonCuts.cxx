@@ -260,7 +260,8 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   fBadRegionCMax(0),
   fBadRegionAMax(0),
   fExcludeMinR(180.),
-  fExcludeMaxR(250.)
+  fExcludeMaxR(250.),
+  fPhotonCutsCache(NULL)
 {
   InitPIDResponse();
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
@@ -441,7 +442,8 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   fBadRegionCMax(ref.fBadRegionCMax),
   fBadRegionAMax(ref.fBadRegionAMax),
   fExcludeMinR(ref.fExcludeMinR),
-  fExcludeMaxR(ref.fExcludeMaxR)
+  fExcludeMaxR(ref.fExcludeMaxR),
+  fPhotonCutsCache(NULL)
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -1387,13 +1389,17 @@ Bool_t AliConversionPhotonCuts::TrackIsSelected(AliConversionPhotonBase *photon,
     Bool_t bFound = kFALSE;
     Int_t v0PosID = posTrack->GetID();
     Int_t v0NegID = negTrack->GetID();
-    AliAODv0* v0 = NULL;
-    for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
-      v0 = aodEvent->GetV0(iV);
-      if(!v0) continue;
-      if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
-        bFound = kTRUE;
-        break;
+    if(fPhotonCutsCache){
+      bFound = fPhotonCutsCache->HasAODV0(aodEvent, v0PosID, v0NegID);
+    } else {
+      AliAODv0* v0 = NULL;
+      for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+        v0 = aodEvent->GetV0(iV);
+        if(!v0) continue;
+        if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
+          bFound = kTRUE;
+          break;
+        }
       }
     }
     if(!bFound){
@@ -1441,13 +1447,17 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
     Bool_t bFound = kFALSE;
     Int_t v0PosID = posTrack->GetID();
     Int_t v0NegID = negTrack->GetID();
-    AliAODv0* v0 = NULL;
-    for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
-      v0 = aodEvent->GetV0(iV);
-      if(!v0) continue;
-      if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
-        bFound = kTRUE;
-        break;
+    if(fPhotonCutsCache){
+      bFound = fPhotonCutsCache->HasAODV0(aodEvent, v0PosID, v0NegID);
+    } else {
+      AliAODv0* v0 = NULL;
+      for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+        v0 = aodEvent->GetV0(iV);
+        if(!v0) continue;
+        if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
+          bFound = kTRUE;
+          break;
+        }
       }
     }
     if(!bFound){
@@ -1858,8 +1868,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
 
   Float_t KappaPlus, KappaMinus, Kappa;
   if(fDoElecDeDxPostCalibration){
-    CentrnSig[0]=fPIDResponse->NumberOfSigmasTPC(negTrack,AliPID::kElectron);
-    CentrnSig[1]=fPIDResponse->NumberOfSigmasTPC(posTrack,AliPID::kElectron);
+    CentrnSig[0]=GetNSigma(negTrack,AliConversionPhotonCutsCache::kTPCElectron);
+    CentrnSig[1]=GetNSigma(posTrack,AliConversionPhotonCutsCache::kTPCElectron);
     P[0]        =negTrack->P();
     P[1]        =posTrack->P();
     Eta[0]      =negTrack->Eta();
@@ -1867,8 +1877,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
     KappaMinus = GetCorrectedElectronTPCResponse(negTrack->Charge(),CentrnSig[0],P[0],Eta[0],negTrack->GetTPCNcls(),gamma->GetConversionRadius());
     KappaPlus =  GetCorrectedElectronTPCResponse(posTrack->Charge(),CentrnSig[1],P[1],Eta[1],posTrack->GetTPCNcls(),gamma->GetConversionRadius());
   }else{
-    KappaMinus = fPIDResponse->NumberOfSigmasTPC(negTrack, AliPID::kElectron);
-    KappaPlus =  fPIDResponse->NumberOfSigmasTPC(posTrack, AliPID::kElectron);
+    KappaMinus = GetNSigma(negTrack, AliConversionPhotonCutsCache::kTPCElectron);
+    KappaPlus =  GetNSigma(posTrack, AliConversionPhotonCutsCache::kTPCElectron);
   }
   Kappa = ( TMath::Abs(KappaMinus) + TMath::Abs(KappaPlus) ) / 2.0 + 2.0*(KappaMinus+KappaPlus);
 
@@ -1910,8 +1920,8 @@ Bool_t AliConversionPhotonCuts::GetBDTVariableValues(AliConversionPhotonBase *ga
   values[2]= (Float_t)negTrack->GetTPCClusterInfo(2,0,GetFirstTPCRow(gamma->GetConversionRadius())); //"fracClsTPCElectron"
   values[3]= nPosClusterITS; //"clsITSPositron"
   values[4]= nNegClusterITS; //"clsITSElectron"
-  values[5]=fPIDResponse->NumberOfSigmasTPC(negTrack,AliPID::kElectron); //"nSigmaTPCElectron"
-  values[6]=fPIDResponse->NumberOfSigmasTPC(posTrack,AliPID::kElectron); //"nSigmaTPCPositron"
+  values[5]=GetNSigma(negTrack,AliConversionPhotonCutsCache::kTPCElectron); //"nSigmaTPCElectron"
+  values[6]=GetNSigma(posTrack,AliConversionPhotonCutsCache::kTPCElectron); //"nSigmaTPCPositron"
 
   return kTRUE;
 }
@@ -1926,7 +1936,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
 
   Short_t Charge    = fCurrentTrack->Charge();
-  Double_t electronNSigmaTPC = fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron);
+  Double_t electronNSigmaTPC = GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCElectron);
   Double_t electronNSigmaTPCCor=0.;
   Double_t P=0.;
   Double_t Eta=0.;
@@ -1959,12 +1969,12 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     // TPC Pion Line
     if( fCurrentTrack->P()>fPIDMinPnSigmaAbovePionLine && fCurrentTrack->P()<fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCPion)<fPIDnSigmaAbovePionLine){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCPion)<fPIDnSigmaAbovePionLine){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
@@ -1975,12 +1985,12 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     // High Pt Pion rej
     if( fCurrentTrack->P()>fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCPion)<fPIDnSigmaAbovePionLineHighPt){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCPion)<fPIDnSigmaAbovePionLineHighPt){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
@@ -1992,7 +2002,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoKaonRejectionLowP == kTRUE && !fSwitchToKappa){
     if(fCurrentTrack->P()<fPIDMinPKaonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
+      if( TMath::Abs(GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCKaon))<fPIDnSigmaAtLowPAroundKaonLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -2002,7 +2012,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoProtonRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPProtonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
+      if( TMath::Abs(GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCProton))<fPIDnSigmaAtLowPAroundProtonLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -2012,7 +2022,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoPionRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPPionRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
+      if( TMath::Abs(GetNSigma(fCurrentTrack,AliConversionPhotonCutsCache::kTPCPion))<fPIDnSigmaAtLowPAroundPionLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -2030,29 +2040,29 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
       Double_t dT = TOFsignal - t0 - times[0];
       fHistoTOFbefore->Fill(fCurrentTrack->P(),dT);
     }
-    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kTOFElectron));
     if(fUseTOFpid){
-      if(fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
-        fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
+      if(GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kTOFElectron)>fTofPIDnSigmaAboveElectronLine ||
+        GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kTOFElectron)<fTofPIDnSigmaBelowElectronLine ){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
-    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kTOFElectron));
   }
   cutIndex++; //8
 
   if((fCurrentTrack->GetStatus() & AliESDtrack::kITSpid)){
-    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kITSElectron));
     if(fUseITSpid){
       if(fCurrentTrack->Pt()<=fMaxPtPIDITS){
-        if(fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
+        if(GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kITSElectron)>fITSPIDnSigmaAboveElectronLine || GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kITSElectron)<fITSPIDnSigmaBelowElectronLine ){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       }
     }
-    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),GetNSigma(fCurrentTrack, AliConversionPhotonCutsCache::kITSElectron));
   }
 
   cutIndex++; //9
@@ -2137,6 +2147,7 @@ AliVTrack *AliConversionPhotonCuts::GetTrack(AliVEvent * event, Int_t label){
 
   } else {
     if(label == -999999) return NULL; // if AOD relabelling goes wrong, immediately return NULL
+    if(fPhotonCutsCache) return fPhotonCutsCache->GetAODTrack(event, label, fV0ReaderName);
     AliVTrack * track = 0x0;
     if(AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data()) && ((AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data()))->AreAODsRelabeled()){
       if(event->GetTrack(label)) track = dynamic_cast<AliVTrack*>(event->GetTrack(label));
@@ -2157,6 +2168,124 @@ AliVTrack *AliConversionPhotonCuts::GetTrack(AliVEvent * event, Int_t label){
   return NULL;
 }
 
+///________________________________________________________________________
+Float_t AliConversionPhotonCuts::GetNSigma(AliVTrack * track, AliConversionPhotonCutsCache::ENSigma_t type){
+  // PID n-sigma of a V0 leg, taken from the cache shared with other cut objects if set
+  if(fPhotonCutsCache) return fPhotonCutsCache->GetNSigma(fPIDResponse, track, type);
+  return AliConversionPhotonCutsCache::ComputeNSigma(fPIDResponse, track, type);
+}
+
+///________________________________________________________________________
+AliConversionPhotonCutsCache::AliConversionPhotonCutsCache() :
+  fEvent(NULL),
+  fV0ReaderName(""),
+  fAODsRelabeled(-1),
+  fTrackMapFilled(kFALSE),
+  fTrackByID(),
+  fV0PairsFilled(kFALSE),
+  fV0Pairs(),
+  fPIDResponse(NULL),
+  fNSigma()
+{
+}
+
+///________________________________________________________________________
+void AliConversionPhotonCutsCache::Reset(){
+  // forget the content of the previous event
+  fEvent = NULL;
+  fAODsRelabeled = -1;
+  fTrackMapFilled = kFALSE;
+  fTrackByID.clear();
+  fV0PairsFilled = kFALSE;
+  fV0Pairs.clear();
+  fNSigma.clear();
+}
+
+///________________________________________________________________________
+void AliConversionPhotonCutsCache::CheckEvent(AliVEvent * event){
+  // the owner resets the cache for each event, a different event object
+  // invalidates the content as well
+  if(event != fEvent){
+    Reset();
+    fEvent = event;
+  }
+}
+
+///________________________________________________________________________
+AliVTrack *AliConversionPhotonCutsCache::GetAODTrack(AliVEvent * event, Int_t label, const TString &v0ReaderName){
+  // same result as AliConversionPhotonCuts::GetTrack on AODs, with the relabelling
+  // flag read and the track ID map built once per event
+  CheckEvent(event);
+  if(fAODsRelabeled < 0 || v0ReaderName.CompareTo(fV0ReaderName) != 0){
+    fV0ReaderName = v0ReaderName;
+    AliV0ReaderV1 *v0Reader = (AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
+    fAODsRelabeled = (v0Reader && v0Reader->AreAODsRelabeled()) ? 1 : 0;
+  }
+  if(fAODsRelabeled){
+    if(event->GetTrack(label)) return dynamic_cast<AliVTrack*>(event->GetTrack(label));
+    return NULL;
+  }
+  if(!fTrackMapFilled){
+    for(Int_t ii=0; ii<event->GetNumberOfTracks(); ii++) {
+      AliVTrack *track = event->GetTrack(ii) ? dynamic_cast<AliVTrack*>(event->GetTrack(ii)) : NULL;
+      // keep the first track with a given ID, as the linear search does
+      if(track) fTrackByID.insert(std::make_pair(track->GetID(), track));
+    }
+    fTrackMapFilled = kTRUE;
+  }
+  std::map<Int_t, AliVTrack*>::const_iterator found = fTrackByID.find(label);
+  return found != fTrackByID.end() ? found->second : NULL;
+}
+
+///________________________________________________________________________
+Bool_t AliConversionPhotonCutsCache::HasAODV0(AliAODEvent * event, Int_t posID, Int_t negID){
+  // true if a V0 with the two tracks (in any order) is in the AOD V0 list
+  CheckEvent(event);
+  if(!fV0PairsFilled){
+    for(Int_t iV=0; iV<event->GetNumberOfV0s(); iV++){
+      AliAODv0 *v0 = event->GetV0(iV);
+      if(!v0) continue;
+      fV0Pairs.insert(std::make_pair(TMath::Min(v0->GetPosID(), v0->GetNegID()), TMath::Max(v0->GetPosID(), v0->GetNegID())));
+    }
+    fV0PairsFilled = kTRUE;
+  }
+  return fV0Pairs.find(std::make_pair(TMath::Min(posID, negID), TMath::Max(posID, negID))) != fV0Pairs.end();
+}
+
+///________________________________________________________________________
+Float_t AliConversionPhotonCutsCache::GetNSigma(AliPIDResponse * pidResponse, AliVTrack * track, ENSigma_t type){
+  // n-sigma of the track, evaluated at the first request in the event
+  if(pidResponse != fPIDResponse){
+    fNSigma.clear();
+    fPIDResponse = pidResponse;
+  }
+  std::map<const AliVTrack*, NSigmaEntry_t>::iterator entry = fNSigma.find(track);
+  if(entry == fNSigma.end()){
+    NSigmaEntry_t empty;
+    empty.fValid = 0;
+    entry = fNSigma.insert(std::make_pair(static_cast<const AliVTrack*>(track), empty)).first;
+  }
+  if(!TESTBIT(entry->second.fValid, type)){
+    entry->second.fNSigma[type] = ComputeNSigma(pidResponse, track, type);
+    SETBIT(entry->second.fValid, type);
+  }
+  return entry->second.fNSigma[type];
+}
+
+///________________________________________________________________________
+Float_t AliConversionPhotonCutsCache::ComputeNSigma(AliPIDResponse * pidResponse, AliVTrack * track, ENSigma_t type){
+  switch(type){
+    case kTPCElectron: return pidResponse->NumberOfSigmasTPC(track, AliPID::kElectron);
+    case kTPCPion:     return pidResponse->NumberOfSigmasTPC(track, AliPID::kPion);
+    case kTPCKaon:     return pidResponse->NumberOfSigmasTPC(track, AliPID::kKaon);
+    case kTPCProton:   return pidResponse->NumberOfSigmasTPC(track, AliPID::kProton);
+    case kTOFElectron: return pidResponse->NumberOfSigmasTOF(track, AliPID::kElectron);
+    case kITSElectron: return pidResponse->NumberOfSigmasITS(track, AliPID::kElectron);
+    default: break;
+  }
+  return 0.;
+}
+
 ///________________________________________________________________________
 AliESDtrack *AliConversionPhotonCuts::GetESDTrack(AliESDEvent * event, Int_t label){
   //Returns pointer to the track with given ESD label
@@ -4625,6 +4754,23 @@ TString AliConversionPhotonCuts::GetCutNumber(){
   return fCutStringRead;
 }
 
+///________________________________________________________________________
+Bool_t AliConversionPhotonCuts::HasSameSelection(AliConversionPhotonCuts *other){
+  // returns true if PhotonIsSelected and InPlaneOutOfPlaneCut give the same result
+  // for both cut objects, so that the result of one can be reused for the other.
+  // Cut histograms are not compared: the caller still has to run the selection
+  // of objects filling cut histograms to fill them.
+  if(!other) return kFALSE;
+  if(other == this) return kTRUE;
+  if(GetCutNumber().CompareTo(other->GetCutNumber()) != 0) return kFALSE;
+  if(fIsHeavyIon != other->fIsHeavyIon) return kFALSE;
+  if(fPreSelCut != other->fPreSelCut || fProcessAODCheck != other->fProcessAODCheck) return kFALSE;
+  if(fDodEdxSigmaCut != other->fDodEdxSigmaCut || fSwitchToKappa != other->fSwitchToKappa) return kFALSE;
+  // post-calibration maps are loaded per object
+  if(fDoElecDeDxPostCalibration || other->fDoElecDeDxPostCalibration) return kFALSE;
+  return kTRUE;
+}
+
 ///________________________________________________________________________
 void AliConversionPhotonCuts::FillElectonLabelArray(AliAODConversionPhoton* photon, Int_t nV0){
 
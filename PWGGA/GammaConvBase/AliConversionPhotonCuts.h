@@ -17,6 +17,9 @@
 #include "AliAnalysisManager.h"
 #include "AliDalitzAODESDMC.h"
 #include "AliDalitzEventMC.h"
+#include <map>
+#include <set>
+#include <utility>
 
 
 class AliESDEvent;
@@ -34,6 +37,59 @@ class TList;
 class AliAnalysisManager;
 class AliAODMCParticle;
 
+/**
+ * @class AliConversionPhotonCutsCache
+ * @brief Inputs of the photon sub-cuts shared by several AliConversionPhotonCuts within one event
+ * @ingroup GammaConv
+ *
+ * The inputs of the photon selection which do not depend on the cut settings are
+ * evaluated once per event and reused by all cut objects attached to the cache
+ * (AliConversionPhotonCuts::SetPhotonCutsCache):
+ * - the lookup of the V0 legs by track ID on AODs,
+ * - the existence check of the V0 in the AOD V0 list,
+ * - the PID n-sigma of the legs, with a bitmask of the values already evaluated per track.
+ * Each cut object still applies its own cut values and fills its own cut QA histograms
+ * with the same values as without the cache. The cache has to be reset at the beginning
+ * of every event.
+ */
+class AliConversionPhotonCutsCache {
+  public:
+    enum ENSigma_t {
+      kTPCElectron = 0,
+      kTPCPion,
+      kTPCKaon,
+      kTPCProton,
+      kTOFElectron,
+      kITSElectron,
+      kNNSigma
+    };
+
+    AliConversionPhotonCutsCache();
+    void Reset();
+
+    AliVTrack * GetAODTrack(AliVEvent * event, Int_t label, const TString &v0ReaderName);
+    Bool_t HasAODV0(AliAODEvent * event, Int_t posID, Int_t negID);
+    Float_t GetNSigma(AliPIDResponse * pidResponse, AliVTrack * track, ENSigma_t type);
+    static Float_t ComputeNSigma(AliPIDResponse * pidResponse, AliVTrack * track, ENSigma_t type);
+
+  private:
+    struct NSigmaEntry_t {
+      UInt_t  fValid;                                         ///< bitmask of the n-sigma values already evaluated
+      Float_t fNSigma[kNNSigma];                              ///< n-sigma values, by ENSigma_t
+    };
+    void CheckEvent(AliVEvent * event);
+
+    AliVEvent*                                  fEvent;           ///< event the cache content belongs to
+    TString                                     fV0ReaderName;    ///< V0 reader the relabelling flag was read from
+    Int_t                                       fAODsRelabeled;   ///< AOD track labels relabelled by the V0 reader (-1: not checked yet)
+    Bool_t                                      fTrackMapFilled;  ///< track ID map built for the event
+    std::map<Int_t, AliVTrack*>                 fTrackByID;       ///< first AOD track with a given ID
+    Bool_t                                      fV0PairsFilled;   ///< V0 list built for the event
+    std::set<std::pair<Int_t, Int_t> >          fV0Pairs;         ///< track IDs of the AOD V0s, ordered within the pair
+    AliPIDResponse*                             fPIDResponse;     ///< PID response the n-sigma values were obtained with
+    std::map<const AliVTrack*, NSigmaEntry_t>   fNSigma;          ///< n-sigma values per track
+};
+
 /**
  * @class AliConversionPhotonCuts
  * @brief Class handling all kinds of selection cuts for Gamma Conversion analysis
@@ -152,6 +208,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     virtual Bool_t IsSelected(TList* /*list*/) {return kTRUE;}
 
     TString GetCutNumber();
+    Bool_t HasSameSelection(AliConversionPhotonCuts *other);
 
     Float_t GetKappaTPC(AliConversionPhotonBase *gamma, AliVEvent *event);
     Bool_t GetBDTVariableValues(AliConversionPhotonBase *gamma, AliVEvent *event, Float_t* values);
@@ -183,6 +240,8 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     void SetProcessAODCheck(Bool_t flag){fProcessAODCheck = flag; return;}
 
     AliVTrack * GetTrack(AliVEvent * event, Int_t label);
+    void SetPhotonCutsCache(AliConversionPhotonCutsCache * cache){fPhotonCutsCache = cache; return;}
+    Float_t GetNSigma(AliVTrack * track, AliConversionPhotonCutsCache::ENSigma_t type);
     AliESDtrack *GetESDTrack(AliESDEvent * event, Int_t label);
 
     ///Cut functions
@@ -436,6 +495,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Double_t          fBadRegionAMax;                       ///<
     Double_t          fExcludeMinR;                         ///< r cut exclude region
     Double_t          fExcludeMaxR;                         ///< r cut exclude region
+    AliConversionPhotonCutsCache* fPhotonCutsCache;         //!<! per-event inputs shared with other cut objects (not owned)
 
   private:
     /// \cond CLASSIMP
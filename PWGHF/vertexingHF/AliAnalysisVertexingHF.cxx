@@ -70,6 +70,7 @@
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
 #include <cstring>
+#include <vector>
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisVertexingHF);
@@ -629,6 +630,27 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // DCAs between the current 1st positive track and the other tracks, both
+  // at the primary vertex. They do not depend on the inner loop tracks, so
+  // they are computed once per 1st positive track (-1 = not yet computed)
+  std::vector<Double_t> dcaP1ToTrk(nSeleTrks,-1.); // postrack1->GetDCA(track)
+  std::vector<Double_t> dcaTrkToP1(nSeleTrks,-1.); // track->GetDCA(postrack1)
+
+  // XY helix circles of the selected tracks, from the parameters at the
+  // primary vertex as set by SetParametersAtVertex before each pair DCA.
+  // Pairs failing IsPairDCACompatible would fail the DCA cut anyway
+  std::vector<Double_t> helixCircles(5*nSeleTrks);
+  AliExternalTrackParam trackAtVertex;
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    const AliExternalTrackParam *extpar=(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk);
+    trackAtVertex.Set(extpar->GetX(),extpar->GetAlpha(),extpar->GetParameter(),extpar->GetCovariance());
+    GetHelixCircle(&trackAtVertex,&helixCircles[5*iTrk]);
+  }
+
+  // neutral tracks of the V0 (cascades) and of the D0 (D*), set again for
+  // every V0 and D0 candidate instead of being allocated each time
+  AliNeutralTrackParam trackV0Param, trackD0Param;
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -671,6 +693,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     // get track from tracks array
     postrack1 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkP1);
     postrack1->GetPxPyPz(mompos1);
+    dcaP1ToTrk.assign(nSeleTrks,-1.);
+    dcaTrkToP1.assign(nSeleTrks,-1.);
 
     // Make cascades with V0+track
     //
@@ -747,13 +771,22 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
         AliNeutralTrackParam *trackV0=NULL;
         if(fInputAOD) {
           const AliVTrack *trackVV0 = dynamic_cast<const AliVTrack*>(v0);
-          if(trackVV0)  trackV0 = new AliNeutralTrackParam(trackVV0);
+          if(trackVV0) {
+            // as in the AliNeutralTrackParam(const AliVTrack*) constructor
+            Double_t xyz[3], pxpypz[3], cv[21];
+            trackVV0->GetXYZ(xyz);
+            pxpypz[0]=trackVV0->Px(); pxpypz[1]=trackVV0->Py(); pxpypz[2]=trackVV0->Pz();
+            trackVV0->GetCovarianceXYZPxPyPz(cv);
+            trackV0Param.Set(xyz,pxpypz,cv,(Short_t)trackVV0->Charge());
+            trackV0 = &trackV0Param;
+          }
         } else {
           Double_t xyz[3], pxpypz[3];
           esdV0->XvYvZv(xyz);
           esdV0->PxPyPz(pxpypz);
           Double_t cv[21]; for(int i=0; i<21; i++) cv[i]=0;
-          trackV0 = new AliNeutralTrackParam(xyz,pxpypz,cv,0);
+          trackV0Param.Set(xyz,pxpypz,cv,0);
+          trackV0 = &trackV0Param;
         }
 
 
@@ -763,7 +796,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
         if(fMassCutBeforeVertexing){
           Bool_t passMassCut = SelectInvMassAndPtCascade(twoTrackArrayCasc);
           if(!passMassCut){
-            delete trackV0; trackV0=NULL;
+            trackV0=NULL;
             if(!fInputAOD) {delete v0; v0=NULL;}
             twoTrackArrayCasc->Clear();
             continue;
@@ -786,7 +819,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
           dcaCasc = 0.;
         }
         if(!vertexCasc) {
-          delete trackV0; trackV0=NULL;
+          trackV0=NULL;
           if(!fInputAOD) {delete v0; v0=NULL;}
           twoTrackArrayCasc->Clear();
           continue;
@@ -815,7 +848,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 
         // Clean up
-        delete trackV0; trackV0=NULL;
+        trackV0=NULL;
         twoTrackArrayCasc->Clear();
         if(ioCascade) { delete ioCascade; ioCascade=NULL; }
         if(vertexCasc) { delete vertexCasc; vertexCasc=NULL; }
@@ -876,7 +909,11 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       negtrack1->GetPxPyPz(momneg1);
 
       // DCA between the two tracks
-      dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+      if(dcaP1ToTrk[iTrkN1]<0.) {
+	if(!IsPairDCACompatible(&helixCircles[5*iTrkP1],&helixCircles[5*iTrkN1],dcaMax)) { negtrack1=0; continue; }
+	dcaP1ToTrk[iTrkN1] = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+      }
+      dcap1n1 = dcaP1ToTrk[iTrkN1];
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
 
       // Vertexing
@@ -947,7 +984,12 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  io2Prong->SetSecondaryVtx(vertexp1n1);
           //printf("--->  %d %d %d %d %d\n",vertexp1n1->GetNDaughters(),iTrkP1,iTrkN1,postrack1->Charge(),negtrack1->Charge());
 	  // create a track from the D0
-	  AliNeutralTrackParam *trackD0 = new AliNeutralTrackParam(io2Prong);
+	  Double_t xyzD0[3], pxpypzD0[3], cvD0[21];
+	  io2Prong->GetXYZ(xyzD0);
+	  pxpypzD0[0]=io2Prong->Px(); pxpypzD0[1]=io2Prong->Py(); pxpypzD0[2]=io2Prong->Pz();
+	  io2Prong->GetCovarianceXYZPxPyPz(cvD0);
+	  trackD0Param.Set(xyzD0,pxpypzD0,cvD0,(Short_t)io2Prong->Charge());
+	  AliNeutralTrackParam *trackD0 = &trackD0Param;
 
 	  // LOOP ON TRACKS THAT PASSED THE SOFT PION CUTS
 	  for(iTrkSoftPi=0; iTrkSoftPi<nSeleTrks; iTrkSoftPi++) {
@@ -1042,7 +1084,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    delete vertexCasc; vertexCasc=NULL;
 	  } // end loop on soft pi tracks
 
-	  if(trackD0) {delete trackD0; trackD0=NULL;}
+	  trackD0=NULL;
 
 	}
 	if(io2Prong) {delete io2Prong; io2Prong=NULL;}
@@ -1139,9 +1181,14 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
+	if(!IsPairDCACompatible(&helixCircles[5*iTrkP2],&helixCircles[5*iTrkN1],dcaMax)) { postrack2=0; continue; }
 	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
-	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
+	if(dcaTrkToP1[iTrkP2]<0.) {
+	  if(!IsPairDCACompatible(&helixCircles[5*iTrkP2],&helixCircles[5*iTrkP1],dcaMax)) { postrack2=0; continue; }
+	  dcaTrkToP1[iTrkP2] = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
+	}
+	dcap1p2 = dcaTrkToP1[iTrkP2];
 	if(dcap1p2>dcaMax) { postrack2=0; continue; }
 
 	// check invariant mass cuts for D+,Ds,Lc
@@ -1277,8 +1324,13 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
-	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	    if(dcaP1ToTrk[iTrkN2]<0.) {
+	      if(!IsPairDCACompatible(&helixCircles[5*iTrkP1],&helixCircles[5*iTrkN2],fCutsD0toKpipipi->GetDCACut())) { negtrack2=0; continue; }
+	      dcaP1ToTrk[iTrkN2] = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	    }
+	    dcap1n2 = dcaP1ToTrk[iTrkN2];
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
+            if(!IsPairDCACompatible(&helixCircles[5*iTrkP2],&helixCircles[5*iTrkN2],fCutsD0toKpipipi->GetDCACut())) { negtrack2=0; continue; }
             dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
             if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
 
@@ -1410,8 +1462,13 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
-	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	if(dcaP1ToTrk[iTrkN2]<0.) {
+	  if(!IsPairDCACompatible(&helixCircles[5*iTrkP1],&helixCircles[5*iTrkN2],dcaMax)) { negtrack2=0; continue; }
+	  dcaP1ToTrk[iTrkN2] = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	}
+	dcap1n2 = dcaP1ToTrk[iTrkN2];
 	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
+	if(!IsPairDCACompatible(&helixCircles[5*iTrkN1],&helixCircles[5*iTrkN2],dcaMax)) { negtrack2=0; continue; }
 	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
 	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
 
@@ -3775,6 +3832,43 @@ void AliAnalysisVertexingHF::SetParametersAtVertex(AliESDtrack* esdt, const AliE
   return;
 }
 //-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::GetHelixCircle(const AliExternalTrackParam* extpar, Double_t circle[5]) const{
+  /// Center and radius of the track helix in XY, plus the Y and Z
+  /// uncertainties entering the weighed DCA returned by GetDCA
+
+  Double_t helix[6];
+  extpar->GetHelixParameters(helix,fBzkG);
+  circle[0]=0.;
+  circle[1]=0.;
+  circle[2]=1e+10; // straight track: no circle
+  if(TMath::Abs(helix[4])>1e-10) {
+    circle[0]=helix[5]-TMath::Sin(helix[2])/helix[4];
+    circle[1]=helix[0]+TMath::Cos(helix[2])/helix[4];
+    circle[2]=TMath::Abs(1./helix[4]);
+  }
+  circle[3]=extpar->GetSigmaY2();
+  circle[4]=extpar->GetSigmaZ2();
+  return;
+}
+//-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::IsPairDCACompatible(const Double_t circle1[5], const Double_t circle2[5], Double_t dcaCut) const{
+  /// Returns kFALSE only for pairs with GetDCA above dcaCut. GetDCA returns
+  /// sqrt(dm*sqrt(dy2*dz2)) evaluated on the two helices, which is never
+  /// below the XY gap between the circles times (dz2/dy2)^(1/4)
+
+  Double_t r1=circle1[2], r2=circle2[2];
+  if(!(r1<1e+10 && r2<1e+10)) return kTRUE; // straight tracks: no bound
+  Double_t dist=TMath::Sqrt((circle1[0]-circle2[0])*(circle1[0]-circle2[0])+(circle1[1]-circle2[1])*(circle1[1]-circle2[1]));
+  Double_t gap=TMath::Max(dist-r1-r2,TMath::Abs(r1-r2)-dist);
+  if(gap<=0.) return kTRUE;
+  Double_t dy2=circle1[3]+circle2[3];
+  Double_t dz2=circle1[4]+circle2[4];
+  if(!(dy2>0. && dz2>0.)) return kTRUE;
+  // safety margin for rounding in the helix evaluation
+  Double_t margin=1e-4+1e-6*(dist+r1+r2);
+  return (gap*TMath::Sqrt(TMath::Sqrt(dz2/dy2)) <= dcaCut+margin);
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SetMasses(){
   /// Set the hadron mass values from TDatabasePDG
 
@@ -420,6 +420,8 @@ class AliAnalysisVertexingHF : public TNamed {
 				   Int_t &nSeleTrks,
 				   UChar_t *seleFlags,Int_t *evtNumber);
   void SetParametersAtVertex(AliESDtrack* esdt, const AliExternalTrackParam* extpar) const;
+  void GetHelixCircle(const AliExternalTrackParam* extpar, Double_t circle[5]) const;
+  Bool_t IsPairDCACompatible(const Double_t circle1[5], const Double_t circle2[5], Double_t dcaCut) const;
 
   Bool_t SingleTrkCuts(AliESDtrack *trk,Float_t centralityperc, Bool_t &okDisplaced,Bool_t &okSoftPi, Bool_t &ok3prong, Bool_t &okBachelor) const;
 
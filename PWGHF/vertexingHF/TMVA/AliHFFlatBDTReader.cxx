@@ -0,0 +1,269 @@
+// Copyright CERN. This software is distributed under the terms of the GNU
+// General Public License v3 (GPL Version 3).
+//
+// See http://www.gnu.org/licenses/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+//**************************************************************************************
+// \class AliHFFlatBDTReader
+// \brief BDT classifier reader evaluating a TMVA .weights.xml file with a flat node array
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+#include "AliHFFlatBDTReader.h"
+
+namespace {
+
+// value of attribute "name" in the xml tag starting at tag (up to the next '>')
+bool GetAttribute(const std::string &xml, size_t tag, const char *name, std::string &value)
+{
+  size_t end = xml.find('>', tag);
+  std::string key = std::string(" ") + name + "=\"";
+  size_t pos = xml.find(key, tag);
+  if (pos == std::string::npos || pos > end) return false;
+  pos += key.size();
+  size_t close = xml.find('"', pos);
+  if (close == std::string::npos || close > end) return false;
+  value = xml.substr(pos, close - pos);
+  return true;
+}
+
+// content of <Option name="name">content</Option>
+bool GetOption(const std::string &xml, const char *name, std::string &value)
+{
+  std::string key = std::string("<Option name=\"") + name + "\"";
+  size_t pos = xml.find(key);
+  if (pos == std::string::npos) return false;
+  size_t begin = xml.find('>', pos);
+  size_t end = xml.find('<', begin);
+  if (begin == std::string::npos || end == std::string::npos) return false;
+  value = xml.substr(begin + 1, end - begin - 1);
+  return true;
+}
+
+} // namespace
+
+//_______________________________________________________________________
+AliHFFlatBDTReader::AliHFFlatBDTReader()
+    : IClassifierReader(),
+      fClassName("AliHFFlatBDTReader"),
+      fNvars(0),
+      fMaxDepth(0),
+      fBoostType(kAdaBoost),
+      fInputVars(),
+      fTreeRoot(),
+      fBoostWeights(),
+      fBoostWeightSum(0),
+      fNodes(),
+      fLeafValue()
+{
+  fStatusIsClean = false;
+}
+
+//_______________________________________________________________________
+AliHFFlatBDTReader::AliHFFlatBDTReader(const std::string &weightsFile, const std::vector<std::string> &theInputVars)
+    : IClassifierReader(),
+      fClassName("AliHFFlatBDTReader"),
+      fNvars(0),
+      fMaxDepth(0),
+      fBoostType(kAdaBoost),
+      fInputVars(),
+      fTreeRoot(),
+      fBoostWeights(),
+      fBoostWeightSum(0),
+      fNodes(),
+      fLeafValue()
+{
+  if (!ReadWeightsFile(weightsFile)) {
+    std::cout << "Problem in class \"" << fClassName << "\": cannot read forest from " << weightsFile << std::endl;
+    fStatusIsClean = false;
+    return;
+  }
+
+  // sanity checks
+  if (theInputVars.size() != fNvars) {
+    std::cout << "Problem in class \"" << fClassName << "\": mismatch in number of input values: "
+              << theInputVars.size() << " != " << fNvars << std::endl;
+    fStatusIsClean = false;
+    return;
+  }
+
+  // validate input variables
+  for (size_t ivar = 0; ivar < theInputVars.size(); ivar++) {
+    if (theInputVars[ivar] != fInputVars[ivar]) {
+      std::cout << "Problem in class \"" << fClassName << "\": mismatch in input variable names" << std::endl
+                << " for variable [" << ivar << "]: " << theInputVars[ivar].c_str() << " != " << fInputVars[ivar] << std::endl;
+      fStatusIsClean = false;
+    }
+  }
+}
+
+//_______________________________________________________________________
+bool AliHFFlatBDTReader::ReadWeightsFile(const std::string &weightsFile)
+{
+  // fill the flat node arrays from the TMVA weights file
+  std::ifstream file(weightsFile.c_str());
+  if (!file) return false;
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string xml = buffer.str();
+
+  std::string value;
+  if (GetOption(xml, "VarTransform", value) && value != "None") {
+    std::cout << "Problem in class \"" << fClassName << "\": variable transformation " << value << " not supported" << std::endl;
+    return false;
+  }
+  if (!GetOption(xml, "BoostType", value)) return false;
+  if (value == "Grad") {
+    fBoostType = kGrad;
+  } else if (value == "AdaBoost" || value == "RealAdaBoost" || value == "Bagging") {
+    std::string yesNoLeaf;
+    fBoostType = (GetOption(xml, "UseYesNoLeaf", yesNoLeaf) && yesNoLeaf == "False") ? kAdaBoostPurity : kAdaBoost;
+  } else {
+    std::cout << "Problem in class \"" << fClassName << "\": boost type " << value << " not supported" << std::endl;
+    return false;
+  }
+
+  // input variables
+  size_t pos = xml.find("<Variables");
+  if (pos == std::string::npos || !GetAttribute(xml, pos, "NVar", value)) return false;
+  fNvars = std::atoi(value.c_str());
+  fInputVars.resize(fNvars);
+  for (size_t ivar = 0; ivar < fNvars; ivar++) {
+    pos = xml.find("<Variable ", pos + 1);
+    std::string index;
+    if (pos == std::string::npos || !GetAttribute(xml, pos, "VarIndex", index) || !GetAttribute(xml, pos, "Expression", value)) return false;
+    size_t ivarXml = std::atoi(index.c_str());
+    if (ivarXml >= fNvars) return false;
+    fInputVars[ivarXml] = value;
+  }
+
+  // trees, the nodes are stored in the order of the file (depth first), the
+  // parents of the current node are kept per depth to set the child indices
+  std::vector<int> parents;
+  std::vector<bool> cutTypes;
+  pos = xml.find("<BinaryTree", pos);
+  while (pos != std::string::npos) {
+    if (!GetAttribute(xml, pos, "boostWeight", value)) return false;
+    fBoostWeights.push_back(std::atof(value.c_str()));
+    fTreeRoot.push_back(fNodes.size());
+
+    size_t treeEnd = xml.find("</BinaryTree>", pos);
+    size_t node = xml.find("<Node ", pos);
+    while (node != std::string::npos && node < treeEnd) {
+      std::string depth, ivar, cut, cType, nType, leaf;
+      if (!GetAttribute(xml, node, "depth", depth) || !GetAttribute(xml, node, "IVar", ivar) ||
+          !GetAttribute(xml, node, "Cut", cut) || !GetAttribute(xml, node, "cType", cType) ||
+          !GetAttribute(xml, node, "nType", nType) || !GetAttribute(xml, node, "pos", value)) return false;
+      if (GetAttribute(xml, node, "NCoef", leaf) && std::atoi(leaf.c_str()) != 0) {
+        std::cout << "Problem in class \"" << fClassName << "\": Fisher cuts not supported" << std::endl;
+        return false;
+      }
+      const char *leafName = (fBoostType == kGrad) ? "res" : "purity";
+      if (!GetAttribute(xml, node, leafName, leaf)) return false;
+
+      int inode = fNodes.size();
+      size_t idepth = std::atoi(depth.c_str());
+      int type = std::atoi(nType.c_str());
+      if (idepth > 0) {
+        if (idepth > parents.size()) return false;
+        fNodes[parents[idepth - 1]].fChildren[value == "r" ? 1 : 0] = inode;
+      }
+      if (parents.size() <= idepth) parents.resize(idepth + 1);
+      if ((int)idepth > fMaxDepth) fMaxDepth = idepth;
+      parents[idepth] = inode;
+
+      // intermediate nodes have node type 0, as in BDTNode
+      int selector = (type == 0) ? std::atoi(ivar.c_str()) : -1;
+      if (type == 0 && (selector < 0 || selector >= (int)fNvars)) return false;
+      Node flatNode;
+      flatNode.fCutValue = std::atof(cut.c_str());
+      flatNode.fSelector = selector;
+      flatNode.fChildren[0] = flatNode.fChildren[1] = -1;
+      fNodes.push_back(flatNode);
+      cutTypes.push_back(std::atoi(cType.c_str()) != 0);
+      fLeafValue.push_back(fBoostType == kAdaBoost ? type : std::atof(leaf.c_str()));
+
+      node = xml.find("<Node ", node + 1);
+    }
+    pos = xml.find("<BinaryTree", treeEnd);
+  }
+
+  // every intermediate node needs both children; for cut type 0 the event
+  // goes right if the input is not above the cut, so the children are swapped
+  for (size_t inode = 0; inode < fNodes.size(); inode++) {
+    Node &flatNode = fNodes[inode];
+    if (flatNode.fSelector < 0) {
+      flatNode.fSelector = 0;
+      flatNode.fCutValue = HUGE_VAL;
+      flatNode.fChildren[0] = flatNode.fChildren[1] = inode;
+      continue;
+    }
+    if (flatNode.fChildren[0] < 0 || flatNode.fChildren[1] < 0) return false;
+    if (!cutTypes[inode]) std::swap(flatNode.fChildren[0], flatNode.fChildren[1]);
+  }
+  fBoostWeightSum = 0;
+  for (size_t itree = 0; itree < fBoostWeights.size(); itree++) fBoostWeightSum += fBoostWeights[itree];
+  return !fTreeRoot.empty();
+}
+
+//_______________________________________________________________________
+inline int AliHFFlatBDTReader::FindLeaf(int iTree, const double *inputValues) const
+{
+  // descend the tree, same decision as BDTNode::GoesRight with the cut type
+  // folded into the order of the children. Leaves point to themselves, so
+  // the loop has a fixed number of steps and no data dependent branch
+  int inode = fTreeRoot[iTree];
+  for (int idepth = 0; idepth < fMaxDepth; idepth++) {
+    const Node &flatNode = fNodes[inode];
+    inode = flatNode.fChildren[inputValues[flatNode.fSelector] > flatNode.fCutValue];
+  }
+  return inode;
+}
+
+//_______________________________________________________________________
+double AliHFFlatBDTReader::Evaluate(const double *inputValues) const
+{
+  // sum over the trees in the same order as the generated classes
+  double sum = 0;
+  if (fBoostType == kGrad) {
+    for (size_t itree = 0; itree < fTreeRoot.size(); itree++) sum += fLeafValue[FindLeaf(itree, inputValues)];
+    return 2.0 / (1.0 + std::exp(-2.0 * sum)) - 1.0;
+  }
+  for (size_t itree = 0; itree < fTreeRoot.size(); itree++) sum += fBoostWeights[itree] * fLeafValue[FindLeaf(itree, inputValues)];
+  return sum / fBoostWeightSum;
+}
+
+//_______________________________________________________________________
+double AliHFFlatBDTReader::GetMvaValue(const std::vector<double> &inputValues) const
+{
+  // classifier response, sanity check first
+  if (!IsStatusClean() || inputValues.size() < fNvars) {
+    std::cout << "Problem in class \"" << fClassName << "\": cannot return classifier response"
+              << " because status is dirty" << std::endl;
+    return 0;
+  }
+  return Evaluate(inputValues.data());
+}
+
+//_______________________________________________________________________
+void AliHFFlatBDTReader::GetMvaValues(int nEntries, const double *inputValues, double *mvaValues) const
+{
+  // classifier response for a block of candidates
+  if (!IsStatusClean()) {
+    std::cout << "Problem in class \"" << fClassName << "\": cannot return classifier response"
+              << " because status is dirty" << std::endl;
+    for (int ientry = 0; ientry < nEntries; ientry++) mvaValues[ientry] = 0;
+    return;
+  }
+  for (int ientry = 0; ientry < nEntries; ientry++) mvaValues[ientry] = Evaluate(inputValues + ientry * fNvars);
+}
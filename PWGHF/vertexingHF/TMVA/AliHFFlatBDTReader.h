@@ -0,0 +1,78 @@
+#ifndef AliHFFlatBDTReader_H
+#define AliHFFlatBDTReader_H
+
+// Copyright CERN. This software is distributed under the terms of the GNU
+// General Public License v3 (GPL Version 3).
+//
+// See http://www.gnu.org/licenses/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+//**************************************************************************************
+// \class AliHFFlatBDTReader
+// \brief BDT classifier reader evaluating a TMVA .weights.xml file with a flat node array
+//
+// Alternative to the TMVA generated ReadBDT_* classes: instead of compiling
+// the forest into the library, the weights file is read at construction and
+// all trees are stored contiguously (feature index, cut, children, leaf value).
+// Supports the AdaBoost (yes/no leaves or purity) and Grad boost types
+// without variable transformation, which covers the classes generated so far.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include "IClassifierReader.h"
+
+class AliHFFlatBDTReader : public IClassifierReader
+{
+ public:
+  AliHFFlatBDTReader();
+  // reads the forest from weightsFile; theInputVars are checked against the
+  // variable expressions of the training, like in the generated classes
+  AliHFFlatBDTReader(const std::string &weightsFile, const std::vector<std::string> &theInputVars);
+  virtual ~AliHFFlatBDTReader() {}
+
+  // the classifier response
+  // "inputValues" is a vector of input values in the same order as the
+  // variables given to the constructor
+  double GetMvaValue(const std::vector<double> &inputValues) const;
+
+  // classifier response of nEntries candidates, inputValues holds the
+  // variables of candidate i at [i*GetNvar(), (i+1)*GetNvar())
+  void GetMvaValues(int nEntries, const double *inputValues, double *mvaValues) const;
+
+  size_t GetNvar() const { return fNvars; }
+  size_t GetNTrees() const { return fTreeRoot.size(); }
+  size_t GetNNodes() const { return fNodes.size(); }
+
+ private:
+  enum EBoostType { kAdaBoost, kAdaBoostPurity, kGrad };
+
+  // one node of the flat forest, children are ordered such that an input
+  // value above the cut goes to fChildren[1] (cut type folded in)
+  struct Node {
+    double fCutValue; // cut value
+    int fSelector;    // input variable
+    int fChildren[2]; // node index for input <= cut and input > cut, the leaf itself for leaves
+  };
+
+  bool ReadWeightsFile(const std::string &weightsFile);
+  int FindLeaf(int iTree, const double *inputValues) const;
+  double Evaluate(const double *inputValues) const;
+
+  std::string fClassName;              // name used in the messages
+  size_t fNvars;                       // number of input variables
+  int fMaxDepth;                       // depth of the deepest leaf
+  EBoostType fBoostType;               // how the leaf values are combined
+  std::vector<std::string> fInputVars; // expressions of the input variables
+
+  std::vector<int> fTreeRoot;          // index of the root node of each tree
+  std::vector<double> fBoostWeights;   // boost weight of each tree
+  double fBoostWeightSum;              // sum of the boost weights, for the normalisation
+  std::vector<Node> fNodes;            // nodes of all trees
+  std::vector<double> fLeafValue;      // node type, purity or response of the leaves
+};
+
+#endif
@@ -6,6 +6,7 @@
 
 
 #pragma link C++ class BDTNode+;
+#pragma link C++ class AliHFFlatBDTReader+;
 #pragma link C++ class ReadBDT_LHC19c2b_2_4_noP+;
 #pragma link C++ class ReadBDT_LHC19c2b_4_6_noP+;
 #pragma link C++ class ReadBDT_LHC19c2b_6_8_noP+;
@@ -25,6 +25,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
  **************************************************************************************/
 #include <vector>
+#include <thread>
 
 #include <TClonesArray.h>
 #include <TMath.h>
@@ -98,8 +99,16 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fExtraJetAlgos(),
+  fExtraRadii(),
+  fExtraRecombSchemes(),
+  fNThreads(1),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fExtraFastJetWrappers(),
+  fExtraJets(),
+  fExtraJetsNames(),
+  fGhosts(),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -140,8 +149,16 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fExtraJetAlgos(),
+  fExtraRadii(),
+  fExtraRecombSchemes(),
+  fNThreads(1),
   fJets(0),
   fFastJetWrapper(name,name),
+  fExtraFastJetWrappers(),
+  fExtraJets(),
+  fExtraJetsNames(),
+  fGhosts(),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -152,6 +169,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
  */
 AliEmcalJetTask::~AliEmcalJetTask()
 {
+  for (UInt_t i = 0; i < fExtraFastJetWrappers.size(); i++) delete fExtraFastJetWrappers[i];
 }
 
 /**
@@ -171,6 +189,32 @@ AliEmcalJetUtility* AliEmcalJetTask::AddUtility(AliEmcalJetUtility* utility)
   return utility;
 }
 
+/**
+ * Add a jet definition to be found from the same constituents and ghosts as the main
+ * jet definition. The jets are stored in a separate collection, with the same name and
+ * selection as the jets of a separate jet finder task with this definition.
+ * The main jet collection is not modified, hence definitions can be added also to a locked task.
+ * @param algo Jet algorithm
+ * @param radius Jet radius
+ * @param reco Recombination scheme
+ */
+void AliEmcalJetTask::AddJetDefinition(EJetAlgo_t algo, Double_t radius, ERecoScheme_t reco)
+{
+  if (fLocalInitialized) {
+    AliError(Form("%s: Jet definitions cannot be added after the initialization of the task.", GetName()));
+    return;
+  }
+
+  if (algo == fJetAlgo && reco == fRecombScheme && TMath::Abs(radius - fRadius) < 1e-6) return;
+  for (UInt_t i = 0; i < fExtraJetAlgos.size(); i++) {
+    if (algo == fExtraJetAlgos[i] && reco == fExtraRecombSchemes[i] && TMath::Abs(radius - fExtraRadii[i]) < 1e-6) return;
+  }
+
+  fExtraJetAlgos.push_back(algo);
+  fExtraRadii.push_back(radius);
+  fExtraRecombSchemes.push_back(reco);
+}
+
 /**
  * This method is called once before analyzing the first event. It executes
  * the Init() method of all utilities (if any).
@@ -235,6 +279,9 @@ Bool_t AliEmcalJetTask::Run()
   InitEvent();
   // clear the jet array (normally a null operation)
   fJets->Delete();
+  for (UInt_t i = 0; i < fExtraJets.size(); i++) {
+    if (fExtraJets[i]) fExtraJets[i]->Delete();
+  }
   Int_t n = FindJets();
 
   if (n == 0) return kFALSE;
@@ -325,20 +372,81 @@ Int_t AliEmcalJetTask::FindJets()
   // run jet finder
   fFastJetWrapper.Run();
 
+  FindExtraJets();
+
   return fFastJetWrapper.GetInclusiveJets().size();
 }
 
+/**
+ * This method finds the jets of the additional jet definitions, using the input vectors
+ * and the ghosts of the main jet definition. With more than one thread (see SetNThreads)
+ * the jet definitions are distributed over the threads; this requires FastJet to be
+ * built thread safe (--enable-thread-safety).
+ */
+void AliEmcalJetTask::FindExtraJets()
+{
+  if (fExtraFastJetWrappers.empty()) return;
+
+  // if the ghosts are not available each jet definition generates its own
+  Double_t ghostArea = 0;
+  fFastJetWrapper.GetGhosts(fGhosts, ghostArea);
+
+  for (UInt_t i = 0; i < fExtraFastJetWrappers.size(); i++) {
+    fExtraFastJetWrappers[i]->Clear();
+    fExtraFastJetWrappers[i]->AddInputVectors(fFastJetWrapper.GetInputVectors());
+  }
+
+  // ghost generation uses the FastJet random number generator, it must not run concurrently
+  Int_t nThreads = fGhosts.empty() ? 1 : TMath::Min(fNThreads, (Int_t)fExtraFastJetWrappers.size());
+  if (nThreads > 1) {
+    std::vector<std::thread> threads;
+    for (Int_t iThread = 0; iThread < nThreads; iThread++) {
+      threads.push_back(std::thread([this, iThread, nThreads, ghostArea]() {
+        for (UInt_t i = iThread; i < fExtraFastJetWrappers.size(); i += nThreads) {
+          fExtraFastJetWrappers[i]->RunWithGhosts(fGhosts, ghostArea);
+        }
+      }));
+    }
+    for (UInt_t iThread = 0; iThread < threads.size(); iThread++) threads[iThread].join();
+  }
+  else {
+    for (UInt_t i = 0; i < fExtraFastJetWrappers.size(); i++) {
+      fExtraFastJetWrappers[i]->RunWithGhosts(fGhosts, ghostArea);
+    }
+  }
+}
+
 /**
  * This method fills the jet output branch (TClonesArray) with the jet found by the FastJet
  * wrapper. Before filling the jet branch, the utilities are prepared. Then the utilities are
  * called for each jet and finally after jet finding the terminate method of all utilities is called.
+ * The jet branches of the additional jet definitions are filled afterwards, without utilities.
  */
 void AliEmcalJetTask::FillJetBranch()
 {
   PrepareUtilities();
 
+  FillJetBranch(fFastJetWrapper, fJets, fRadius, kTRUE);
+
+  TerminateUtilities();
+
+  for (UInt_t i = 0; i < fExtraFastJetWrappers.size(); i++) {
+    if (!fExtraJets[i]) continue;
+    FillJetBranch(*fExtraFastJetWrappers[i], fExtraJets[i], fExtraRadii[i], kFALSE);
+  }
+}
+
+/**
+ * This method fills a jet output branch (TClonesArray) with the jets found by a FastJet wrapper.
+ * @param wrapper FastJet wrapper which found the jets
+ * @param jets Output jet branch
+ * @param radius Jet radius, used to determine the acceptance of the jets
+ * @param doUtilities If kTRUE the utilities are called for each jet
+ */
+void AliEmcalJetTask::FillJetBranch(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t doUtilities)
+{
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  std::vector<fastjet::PseudoJet> jets_incl = wrapper.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -346,27 +454,27 @@ void AliEmcalJetTask::FillJetBranch()
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
+    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), wrapper.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
-    if (fFastJetWrapper.GetJetArea(ij) < fMinJetArea) continue;
+    if (wrapper.GetJetArea(ij) < fMinJetArea) continue;
     if ((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax) ||
         (jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax))
       continue;
 
-    AliEmcalJet *jet = new ((*fJets)[jetCount])
+    AliEmcalJet *jet = new ((*jets)[jetCount])
     		          AliEmcalJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
     jet->SetLabel(ij);
 
-    fastjet::PseudoJet area(fFastJetWrapper.GetJetAreaVector(ij));
+    fastjet::PseudoJet area(wrapper.GetJetAreaVector(ij));
     jet->SetArea(area.perp());
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
-    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
+    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), radius));
 
     // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
+    std::vector<fastjet::PseudoJet> constituents(wrapper.GetJetConstituents(ij));
     FillJetConstituents(jet, constituents, constituents);
 
     if (fGeom) {
@@ -377,13 +485,11 @@ void AliEmcalJetTask::FillJetBranch()
         jet->SetAxisInEmcal(kTRUE);
     }
 
-    ExecuteUtilities(jet, ij);
+    if (doUtilities) ExecuteUtilities(jet, ij);
 
     AliDebug(2,Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
     jetCount++;
   }
-
-  TerminateUtilities();
 }
 
 /**
@@ -474,6 +580,38 @@ void AliEmcalJetTask::ExecOnce()
     fFastJetWrapper.SetLegacyMode(kTRUE);
   }
 
+  // additional jet definitions: same settings as the main one, except algorithm, radius and recombination scheme
+  if (!fExtraJetAlgos.empty() && fUtilities && fUtilities->GetEntriesFast() > 0) {
+    AliWarning(Form("%s: The jet utilities are applied only to the jets of the main jet definition!", GetName()));
+  }
+  for (UInt_t i = 0; i < fExtraJetAlgos.size(); i++) {
+    EJetAlgo_t algo = static_cast<EJetAlgo_t>(fExtraJetAlgos[i]);
+    ERecoScheme_t reco = static_cast<ERecoScheme_t>(fExtraRecombSchemes[i]);
+    TString jetsName = AliJetContainer::GenerateJetName(fJetType, algo, reco, fExtraRadii[i], GetParticleContainer(0), GetClusterContainer(0), fJetsTag);
+    std::cout << GetName() << ": Name of the additional jet container: " << jetsName << std::endl;
+
+    TClonesArray *jets = 0;
+    if (!(InputEvent()->FindListObject(jetsName))) {
+      jets = new TClonesArray("AliEmcalJet");
+      jets->SetName(jetsName);
+      ::Info("AliEmcalJetTask::ExecOnce", "Jet collection with name '%s' has been added to the event.", jetsName.Data());
+      InputEvent()->AddObject(jets);
+    }
+    else {
+      AliError(Form("%s: Object with name %s already in event! Skipping this jet definition", GetName(), jetsName.Data()));
+    }
+
+    AliFJWrapper *wrapper = new AliFJWrapper(jetsName, jetsName);
+    wrapper->CopySettingsFrom(fFastJetWrapper);
+    wrapper->SetR(fExtraRadii[i]);
+    wrapper->SetAlgorithm(ConvertToFJAlgo(algo));
+    wrapper->SetRecombScheme(ConvertToFJRecoScheme(reco));
+
+    fExtraFastJetWrappers.push_back(wrapper);
+    fExtraJets.push_back(jets);
+    fExtraJetsNames.push_back(jetsName);
+  }
+
   InitUtilities();
 
   AliAnalysisTaskEmcal::ExecOnce();
@@ -71,6 +71,11 @@ namespace fastjet {
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
  * deriving a new class from AliEmcalJetUtility to interface functionalities of the FastJet contribs.
+ *
+ * Additional jet definitions (algorithm, radius, recombination scheme) can be added with AddJetDefinition(),
+ * e.g. several radii for the same constituents. Their jets are found from the input vectors and ghosts
+ * of the main jet definition, which are built only once per event, and fill their own jet collections
+ * with the same name and content as a separate jet finder task with the same settings (utilities excepted).
  */
 class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  public:
@@ -116,6 +121,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetPhiRange(Double_t pmi, Double_t pma);
 
   AliEmcalJetUtility*    AddUtility(AliEmcalJetUtility* utility);
+  void                   AddJetDefinition(EJetAlgo_t algo, Double_t radius, ERecoScheme_t reco = AliJetContainer::pt_scheme);
+  void                   SetNThreads(Int_t n)                       { fNThreads = n; }
 
   Double_t               GetGhostArea()                   { return fGhostArea         ; }
   const char*            GetJetsName()                    { return fJetsName.Data()   ; }
@@ -137,6 +144,9 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   TClonesArray*          GetJets()                        { return fJets              ; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
+  Int_t                  GetNExtraJetDefinitions() const  { return fExtraJetAlgos.size(); }
+  const char*            GetExtraJetsName(Int_t i) const  { return (i >= 0 && i < (Int_t)fExtraJetsNames.size()) ? fExtraJetsNames[i].Data() : 0; }
+  TClonesArray*          GetExtraJets(Int_t i) const      { return (i >= 0 && i < (Int_t)fExtraJets.size()) ? fExtraJets[i] : 0; }
 
   void                   FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet::PseudoJet>& constituents,
                                              std::vector<fastjet::PseudoJet>& constituents_sub, Int_t flag = 0, TString particlesSubName = "");
@@ -183,7 +193,9 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  protected:
 
   Int_t                  FindJets();
+  void                   FindExtraJets();
   void                   FillJetBranch();
+  void                   FillJetBranch(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t doUtilities);
   void                   ExecOnce();
   void                   InitEvent();
   void                   InitUtilities();
@@ -227,9 +239,17 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 fEnableAliBasicParticleCompatibility; ///< Flag to allow compatibility with AliBasicParticle constituents
   Bool_t                 fLegacyMode;             //!<!=true to enable FJ 2.x behavior
   Bool_t                 fFillGhost;              ///< =true ghost particles will be filled in AliEmcalJet obj
+  std::vector<Int_t>     fExtraJetAlgos;          ///< jet algorithms of the additional jet definitions
+  std::vector<Double_t>  fExtraRadii;             ///< jet radii of the additional jet definitions
+  std::vector<Int_t>     fExtraRecombSchemes;     ///< recombination schemes of the additional jet definitions
+  Int_t                  fNThreads;               ///< number of threads finding the jets of the additional jet definitions
 
   TClonesArray          *fJets;                   //!<!jet collection
   AliFJWrapper           fFastJetWrapper;         //!<!fastjet wrapper
+  std::vector<AliFJWrapper*> fExtraFastJetWrappers; //!<!fastjet wrappers of the additional jet definitions
+  std::vector<TClonesArray*> fExtraJets;          //!<!jet collections of the additional jet definitions
+  std::vector<TString>   fExtraJetsNames;         //!<!names of the jet collections of the additional jet definitions
+  std::vector<fastjet::PseudoJet> fGhosts;        //!<!ghosts of the main jet definition, shared with the additional ones
 
   static const Int_t     fgkConstIndexShift;      //!<!contituent index shift
 
@@ -244,7 +264,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 30);
+  ClassDef(AliEmcalJetTask, 31);
   /// \endcond
 };
 #endif
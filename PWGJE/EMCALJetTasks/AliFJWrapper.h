@@ -28,9 +28,11 @@ class AliFJWrapper
   fastjet::ClusterSequenceArea*           GetClusterSequence() const   { return fClustSeq;                 }
   fastjet::ClusterSequence*               GetClusterSequenceSA() const { return fClustSeqSA;               }
   fastjet::ClusterSequenceActiveAreaExplicitGhosts* GetClusterSequenceGhosts() const { return fClustSeqActGhosts; }
+  fastjet::ClusterSequenceActiveAreaExplicitGhosts* GetClusterSequenceSharedGhosts() const { return fClustSeqSharedGhosts; }
   const std::vector<fastjet::PseudoJet>&  GetInputVectors()    const { return fInputVectors;               }
   const std::vector<fastjet::PseudoJet>&  GetEventSubInputVectors()    const { return fEventSubInputVectors;               }
   const std::vector<fastjet::PseudoJet>&  GetInputGhosts()     const { return fInputGhosts;                }
+  Bool_t                                  GetGhosts(std::vector<fastjet::PseudoJet>& ghosts, Double_t& ghostArea) const;
   const std::vector<fastjet::PseudoJet>&  GetInclusiveJets()   const { return fInclusiveJets;              }
   const std::vector<fastjet::PseudoJet>&  GetEventSubJets()   const { return fEventSubJets;              }
   const std::vector<fastjet::PseudoJet>&  GetFilteredJets()    const { return fFilteredJets;               }
@@ -88,6 +90,7 @@ class AliFJWrapper
   virtual void RemoveLastInputVector();
 
   virtual Int_t Run();
+  virtual Int_t RunWithGhosts(const std::vector<fastjet::PseudoJet>& ghosts, Double_t ghostArea);
   virtual Int_t Filter();
   virtual void  DoGenericSubtraction(const fastjet::FunctionOfPseudoJet<Double32_t>& jetshape, std::vector<fastjet::contrib::GenericSubtractorInfo>& output);
   virtual Int_t DoGenericSubtractionJetMass();
@@ -172,6 +175,7 @@ class AliFJWrapper
   fastjet::ClusterSequenceArea          *fClustSeqES;           //!
   fastjet::ClusterSequence              *fClustSeqSA;                //!
   fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqActGhosts; //!
+  fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqSharedGhosts; //! jets found with ghosts given by the user (RunWithGhosts)
   fastjet::Strategy                      fStrategy;           //!
   fastjet::JetAlgorithm                  fAlgor;              //!
   fastjet::RecombinationScheme           fScheme;             //!
@@ -238,6 +242,7 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominatorSub; //!
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  const fastjet::ClusterSequenceAreaBase* GetAreaClusterSequence() const { return fClustSeq ? static_cast<const fastjet::ClusterSequenceAreaBase*>(fClustSeq) : fClustSeqSharedGhosts; }
 
  private:
   AliFJWrapper();
@@ -281,6 +286,7 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fClustSeqES        (0)
   , fClustSeqSA        (0)
   , fClustSeqActGhosts (0)
+  , fClustSeqSharedGhosts (0)
   , fStrategy          (fj::Best)
   , fAlgor             (fj::kt_algorithm)
   , fScheme            (fj::BIpt_scheme)
@@ -365,6 +371,7 @@ void AliFJWrapper::ClearMemory()
   if (fClustSeqES)          { delete fClustSeqES;        fClustSeqES        = NULL; }
   if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
   if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
+  if (fClustSeqSharedGhosts) { delete fClustSeqSharedGhosts; fClustSeqSharedGhosts = NULL; }
   #ifdef FASTJET_VERSION
   if (fBkrdEstimator)          { delete fBkrdEstimator; fBkrdEstimator = NULL; }
   if (fGenSubtractor)          { delete fGenSubtractor; fGenSubtractor = NULL; }
@@ -514,7 +521,7 @@ Double_t AliFJWrapper::GetJetArea(UInt_t idx) const
 
   Double_t retval = -1; // really wrong area..
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area(fInclusiveJets[idx]);
+    retval = GetAreaClusterSequence()->area(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -554,7 +561,7 @@ fastjet::PseudoJet AliFJWrapper::GetJetAreaVector(UInt_t idx) const
   // Get the jet area as vector.
   fastjet::PseudoJet retval;
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area_4vector(fInclusiveJets[idx]);
+    retval = GetAreaClusterSequence()->area_4vector(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -621,7 +628,7 @@ AliFJWrapper::GetJetConstituents(UInt_t idx) const
   std::vector<fastjet::PseudoJet> retval;
 
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->constituents(fInclusiveJets[idx]);
+    retval = GetAreaClusterSequence()->constituents(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetConstituents wrong index: %d",idx));
   }
@@ -670,7 +677,8 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
   // Get the median and sigma from fastjet.
   // User can also do it on his own because the cluster sequence is exposed (via a getter)
 
-  if (!fClustSeq) {
+  const fj::ClusterSequenceAreaBase *clustSeq = GetAreaClusterSequence();
+  if (!clustSeq) {
     AliError("[e] Run the jfinder first.");
     return;
   }
@@ -678,11 +686,11 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
   Double_t mean_area = 0;
   try {
     if(0 == remove) {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      clustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }  else {
-      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(fClustSeq->inclusive_jets());
+      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(clustSeq->inclusive_jets());
       input_jets.erase(input_jets.begin(), input_jets.begin() + remove);
-      fClustSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
+      clustSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
       input_jets.clear();
     }
   } catch (fj::Error) {
@@ -773,6 +781,65 @@ Int_t AliFJWrapper::Run()
   return 0;
 }
 
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::RunWithGhosts(const std::vector<fj::PseudoJet>& ghosts, Double_t ghostArea)
+{
+  // Run the jet finder with explicit ghosts given by the user instead of generating them,
+  // e.g. to share the ghosts of another wrapper (see GetGhosts). The result is the same as
+  // the one of Run() with active_area_explicit_ghosts for the same ghosts.
+  // Other configurations fall back to Run().
+
+  if (fAreaType != fj::active_area_explicit_ghosts || fAlgor == fj::plugin_algorithm || fEventSub || ghosts.empty()) {
+    return Run();
+  }
+
+#ifndef FASTJET_VERSION
+  fRange = new fj::RangeDefinition(fMaxRap - 0.95 * fR);
+#else
+  fRange = new fj::Selector(fj::SelectorAbsRapMax(fMaxRap - 0.95 * fR));
+#endif
+
+  fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+
+  try {
+    fClustSeqSharedGhosts = new fj::ClusterSequenceActiveAreaExplicitGhosts(fInputVectors, *fJetDef, ghosts, ghostArea);
+  } catch (fj::Error) {
+    AliError(" [w] FJ Exception caught.");
+    return -1;
+  }
+
+#ifdef FASTJET_VERSION
+  fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
+#endif
+
+  if (fLegacyMode) { SetLegacyFJ(); }
+
+  fInclusiveJets.clear();
+  fEventSubJets.clear();
+  fInclusiveJets = fClustSeqSharedGhosts->inclusive_jets(0.0);
+
+  return 0;
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliFJWrapper::GetGhosts(std::vector<fj::PseudoJet>& ghosts, Double_t& ghostArea) const
+{
+  // Get the ghosts used in the last Run() with active_area_explicit_ghosts and the area of each ghost.
+
+  ghosts.clear();
+  ghostArea = 0;
+
+  if (!fClustSeq || !fGhostedAreaSpec || fAreaType != fj::active_area_explicit_ghosts) return kFALSE;
+
+  const std::vector<fj::PseudoJet>& particles = fClustSeq->jets();
+  for (UInt_t i = 0; i < fClustSeq->n_particles(); i++) {
+    if (fClustSeq->is_pure_ghost(particles[i])) ghosts.push_back(particles[i]);
+  }
+  ghostArea = fGhostedAreaSpec->actual_ghost_area();
+
+  return !ghosts.empty();
+}
+
 //_________________________________________________________________________________________________
 Int_t AliFJWrapper::Filter()
 {
@@ -846,7 +913,7 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
   // check what was specified (default is -1)
   if (median_pt < 0) {
     try {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      GetAreaClusterSequence()->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }
 
     catch (fj::Error) {
@@ -872,13 +939,13 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
   for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
     if ( fUseArea4Vector ) {
       // subtract the background using the area4vector
-      fj::PseudoJet area4v = fClustSeq->area_4vector(fInclusiveJets[i]);
+      fj::PseudoJet area4v = GetAreaClusterSequence()->area_4vector(fInclusiveJets[i]);
       fj::PseudoJet jet_sub = fInclusiveJets[i] - area4v * fMedUsedForBgSub;
       fSubtractedJetsPt.push_back(jet_sub.perp()); // here we put only the pt of the jet - note: this can be negative
     } else {
       // subtract the background using scalars
       // fj::PseudoJet jet_sub = fInclusiveJets[i] - area * fMedUsedForBgSub_;
-      Double_t area = fClustSeq->area(fInclusiveJets[i]);
+      Double_t area = GetAreaClusterSequence()->area(fInclusiveJets[i]);
       // standard subtraction
       Double_t pt_sub = fInclusiveJets[i].perp() - fMedUsedForBgSub * area;
       fSubtractedJetsPt.push_back(pt_sub); // here we put only the pt of the jet - note: this can be negative
@@ -19,9 +19,12 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
 #include <TH2F.h>
 #include <THnSparse.h>
+#include <TVector2.h>
 
 #include "AliTLorentzVector.h"
 #include "AliAnalysisManager.h"
@@ -59,6 +62,13 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fPtgAxis(0),
   fDBCAxis(0),
   fJetRelativeEPAngle(0),
+  fJets2ByCell(),
+  fJets2ByTrack(),
+  fJets2ByCluster(),
+  fJets2EtaMin(0),
+  fJets2CellSize(0),
+  fJets2NEta(0),
+  fJets2NPhi(0),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
   fHistRejectionReason1(0),
@@ -148,6 +158,13 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fPtgAxis(0),
   fDBCAxis(0),
   fJetRelativeEPAngle(0),
+  fJets2ByCell(),
+  fJets2ByTrack(),
+  fJets2ByCluster(),
+  fJets2EtaMin(0),
+  fJets2CellSize(0),
+  fJets2NEta(0),
+  fJets2NPhi(0),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
   fHistRejectionReason1(0),
@@ -1417,6 +1434,9 @@ Bool_t AliJetResponseMaker::DoJetMatching()
 void AliJetResponseMaker::DoJetLoop()
 {
   // Do the jet loop.
+  // Only the pairs which can be matched are tested: the jets 2 are indexed by (eta,phi) cell
+  // for the geometrical matching and by constituent for the other matching types.
+  // The pairs are tested in the same order as in the full loop, so the closest jets are the same.
 
   AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
   AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
@@ -1429,19 +1449,149 @@ void AliJetResponseMaker::DoJetLoop()
   jets2->ResetCurrentID();
   while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
 
+  Bool_t useIndex = IndexJets2(jets2);
+  SharedConstituents shared;
+  std::vector<Int_t> candidates;
+
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
     jet1->ResetMatching();
 
     if (jet1->MCPt() < fMinJetMCPt) continue;
 
-    jets2->ResetCurrentID();
-    while ((jet2 = jets2->GetNextJet())) {
-      SetMatchingLevel(jet1, jet2, fMatching);
+    if (fMatching == kMCLabel) GetMCLabelSharedConstituents(jet1, shared);
+    else if (fMatching == kSameCollections) GetSameCollectionsSharedConstituents(jet1, shared);
+
+    candidates.clear();
+    if (useIndex) {
+      GetJets2Candidates(jet1, shared, candidates);
+    }
+    else {
+      jets2->ResetCurrentID();
+      while ((jet2 = jets2->GetNextJet())) candidates.push_back(jets2->GetCurrentID());
+    }
+
+    for (UInt_t iCand = 0; iCand < candidates.size(); iCand++) {
+      jet2 = jets2->GetJet(candidates[iCand]);
+      Double_t d1 = -1;
+      Double_t d2 = -1;
+      switch (fMatching) {
+      case kGeometrical:
+        GetGeometricalMatchingLevel(jet1, jet2, d1);
+        d2 = d1;
+        break;
+      case kMCLabel: // jet1 = detector level and jet2 = particle level!
+        GetMCLabelMatchingLevel(shared, jet2, d1, d2);
+        break;
+      case kSameCollections:
+        GetSameCollectionsMatchingLevel(jet1, shared, jet2, d1, d2);
+        break;
+      default:
+        ;
+      }
+      SetMatchingLevel(jet1, jet2, d1, d2);
     } // jet2 loop
   } // jet1 loop
 }
 
+//________________________________________________________________________
+Bool_t AliJetResponseMaker::IndexJets2(AliJetContainer *jets2)
+{
+  // Index the jets 2 for DoJetLoop, return kFALSE if all pairs have to be tested.
+
+  AliEmcalJet* jet2 = 0;
+
+  if (fMatching == kGeometrical) {
+    // cells at least as large as the maximum distance, so that the pairs within it are in neighbouring cells
+    Double_t maxDistance = TMath::Max(fMatchingPar1, fMatchingPar2);
+    if (maxDistance <= 0) return kFALSE;
+    fJets2CellSize = maxDistance * 1.0001;
+    fJets2NPhi = TMath::Max(1, TMath::FloorNint(TMath::TwoPi() / fJets2CellSize));
+
+    Double_t etaMax = 0;
+    fJets2EtaMin = 0;
+    Bool_t first = kTRUE;
+    jets2->ResetCurrentID();
+    while ((jet2 = jets2->GetNextJet())) {
+      if (first || jet2->Eta() < fJets2EtaMin) fJets2EtaMin = jet2->Eta();
+      if (first || jet2->Eta() > etaMax) etaMax = jet2->Eta();
+      first = kFALSE;
+    }
+    fJets2NEta = TMath::FloorNint((etaMax - fJets2EtaMin) / fJets2CellSize) + 1;
+
+    if (fJets2ByCell.size() < UInt_t(fJets2NEta * fJets2NPhi)) fJets2ByCell.resize(fJets2NEta * fJets2NPhi);
+    for (UInt_t iCell = 0; iCell < fJets2ByCell.size(); iCell++) fJets2ByCell[iCell].clear();
+
+    jets2->ResetCurrentID();
+    while ((jet2 = jets2->GetNextJet())) {
+      Int_t iEta = TMath::Min(fJets2NEta - 1, TMath::FloorNint((jet2->Eta() - fJets2EtaMin) / fJets2CellSize));
+      Int_t iPhi = TMath::Min(fJets2NPhi - 1, TMath::FloorNint(TVector2::Phi_0_2pi(jet2->Phi()) / (TMath::TwoPi() / fJets2NPhi)));
+      fJets2ByCell[iEta * fJets2NPhi + iPhi].push_back(jets2->GetCurrentID());
+    }
+    return kTRUE;
+  }
+
+  // a pair without common constituents has matching level 1 (or -1), it can be skipped if it cannot pass the cuts
+  if (fMatchingPar1 >= 1 || fMatchingPar2 >= 1) return kFALSE;
+  if (fMatching == kSameCollections && fUseCellsToMatch && fCaloCells) return kFALSE;
+  if (fMatching != kMCLabel && fMatching != kSameCollections) return kFALSE;
+
+  for (UInt_t i = 0; i < fJets2ByTrack.size(); i++) fJets2ByTrack[i].clear();
+  for (UInt_t i = 0; i < fJets2ByCluster.size(); i++) fJets2ByCluster[i].clear();
+
+  jets2->ResetCurrentID();
+  while ((jet2 = jets2->GetNextJet())) {
+    for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+      Int_t index2 = jet2->TrackAt(iTrack2);
+      if (index2 < 0) continue;
+      if (UInt_t(index2) >= fJets2ByTrack.size()) fJets2ByTrack.resize(index2 + 1);
+      fJets2ByTrack[index2].push_back(jets2->GetCurrentID());
+    }
+    if (fMatching != kSameCollections) continue;
+    for (Int_t iClus2 = 0; iClus2 < jet2->GetNumberOfClusters(); iClus2++) {
+      Int_t index2 = jet2->ClusterAt(iClus2);
+      if (index2 < 0) continue;
+      if (UInt_t(index2) >= fJets2ByCluster.size()) fJets2ByCluster.resize(index2 + 1);
+      fJets2ByCluster[index2].push_back(jets2->GetCurrentID());
+    }
+  }
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::GetJets2Candidates(AliEmcalJet *jet1, const SharedConstituents &shared, std::vector<Int_t> &candidates) const
+{
+  // Jets 2 which can be matched to jet1 according to the index filled in IndexJets2, in the order of the container.
+
+  if (fMatching == kGeometrical) {
+    Int_t iEta = TMath::FloorNint((jet1->Eta() - fJets2EtaMin) / fJets2CellSize);
+    Int_t iPhi = TMath::Min(fJets2NPhi - 1, TMath::FloorNint(TVector2::Phi_0_2pi(jet1->Phi()) / (TMath::TwoPi() / fJets2NPhi)));
+    Int_t nPhiNeighbours = TMath::Min(3, fJets2NPhi);
+    for (Int_t iEtaCell = TMath::Max(0, iEta - 1); iEtaCell <= TMath::Min(fJets2NEta - 1, iEta + 1); iEtaCell++) {
+      for (Int_t iNeighbour = 0; iNeighbour < nPhiNeighbours; iNeighbour++) {
+        Int_t iPhiCell = (iPhi - 1 + iNeighbour + fJets2NPhi) % fJets2NPhi;
+        const std::vector<Int_t> &cell = fJets2ByCell[iEtaCell * fJets2NPhi + iPhiCell];
+        candidates.insert(candidates.end(), cell.begin(), cell.end());
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    return;
+  }
+
+  for (UInt_t i = 0; i < shared.fTracks.size(); i++) {
+    Int_t index = shared.fTracks[i].first;
+    if (index < 0 || UInt_t(index) >= fJets2ByTrack.size()) continue;
+    candidates.insert(candidates.end(), fJets2ByTrack[index].begin(), fJets2ByTrack[index].end());
+  }
+  for (UInt_t i = 0; i < shared.fClusters.size(); i++) {
+    Int_t index = shared.fClusters[i].first;
+    if (index < 0 || UInt_t(index) >= fJets2ByCluster.size()) continue;
+    candidates.insert(candidates.end(), fJets2ByCluster[index].begin(), fJets2ByCluster[index].end());
+  }
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+}
+
 //________________________________________________________________________
 void AliJetResponseMaker::GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const
 {
@@ -1456,16 +1606,30 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
 
   if (!jets1 || !jets1->GetArray() || !jets2 || !jets2->GetArray()) return;
 
+  SharedConstituents shared;
+  GetMCLabelSharedConstituents(jet1, shared);
+  GetMCLabelMatchingLevel(shared, jet2, d1, d2);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::GetMCLabelSharedConstituents(AliEmcalJet *jet1, SharedConstituents &shared) const
+{
+  // Constituents of jet1 associated with a MC particle, by index of the particle in the jet 2 container.
+  // The contributions are stored in the order in which they are subtracted in GetMCLabelMatchingLevel.
+
+  AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+
+  shared.Clear();
+
   // tracks1 just serves as a proxy to ensure that tracks are in jets1
   AliParticleContainer *tracks1   = jets1->GetParticleContainer();
   // tracks2 is used to retrieve MC labels associated with tracks in the container
   // NOTE: For multiple containers, this would need to be generalized!
   AliParticleContainer *tracks2   = jets2->GetParticleContainer();
 
-  // d1 and d2 represent the matching level: 0 = maximum level of matching, 1 = the two jets are completely unrelated
-  d1 = jet1->Pt();
-  d2 = jet2->Pt();
-  Double_t totalPt1 = d1; // the total pt of the reconstructed jet will be cleaned from the background
+  shared.fPt = jet1->Pt();
+  shared.fTotalPt = shared.fPt; // the total pt of the reconstructed jet will be cleaned from the background
 
   // remove completely tracks that are not MC particles (label == 0)
   if (tracks1 && tracks1->GetArray()) {
@@ -1482,8 +1646,8 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
 
       // this is not a MC particle; remove it completely
       AliDebug(3,Form("Track %d (pT = %f) is not a MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
-      totalPt1 -= track->Pt();
-      d1 -= track->Pt();
+      shared.fTotalPt -= track->Pt();
+      shared.fPt -= track->Pt();
     }
   }
 
@@ -1508,8 +1672,8 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
 
         // this is not a MC particle; remove it completely
         AliDebug(3,Form("Cell %d (frac = %f) is not a MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
-        totalPt1 -= part.Pt() * cellFrac;
-        d1 -= part.Pt() * cellFrac;
+        shared.fTotalPt -= part.Pt() * cellFrac;
+        shared.fPt -= part.Pt() * cellFrac;
       }
     }
   }
@@ -1529,127 +1693,122 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
 
       // this is not a MC particle; remove it completely
       AliDebug(3,Form("Cluster %d (pT = %f) is not a MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
-      totalPt1 -= part.Pt();
-      d1 -= part.Pt();
+      shared.fTotalPt -= part.Pt();
+      shared.fPt -= part.Pt();
     }
   }
 
-  for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
-    Bool_t track2Found = kFALSE;
-    Int_t index2 = jet2->TrackAt(iTrack2);
+  // now look for particles associated with MC particles in the track array
+  for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+    AliVParticle *track = jet1->Track(iTrack);
+    if (!track) {
+      AliWarning(Form("Could not find track %d!", iTrack));
+      continue;
+    }
+    Int_t MClabel = TMath::Abs(track->GetLabel());
+    MClabel -= fMCLabelShift;	  
+    if (MClabel <= 0) continue;
+
+    Int_t index = -1;
+    index = tracks2->GetIndexFromLabel(MClabel);
+    if (index < 0) {
+      AliDebug(2,Form("Track %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
+      continue;
+    }
 
-    // now look for common particles in the track array
-    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
-      AliVParticle *track = jet1->Track(iTrack);
-      if (!track) {
-        AliWarning(Form("Could not find track %d!", iTrack));
-        continue;
-      }
-      Int_t MClabel = TMath::Abs(track->GetLabel());
-      MClabel -= fMCLabelShift;	  
-      if (MClabel <= 0) continue;
+    shared.fTracks.push_back(std::make_pair(index, Int_t(shared.fPtShared.size())));
+    shared.fPtShared.push_back(track->Pt());
+    shared.fFraction.push_back(1.);
+  }
 
-      Int_t index = -1;
-      index = tracks2->GetIndexFromLabel(MClabel);
-      if (index < 0) {
-        AliDebug(2,Form("Track %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
+  // now look for particles associated with MC particles in the cluster array
+  if (fUseCellsToMatch && fCaloCells) { // if the cell colection is available, look for cells with a matched MC particle
+    for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+      AliVCluster *clus = jet1->Cluster(iClus);
+      if (!clus) {
+        AliWarning(Form("Could not find cluster %d!", iClus));
         continue;
       }
+      AliTLorentzVector part;
+      clus->GetMomentum(part, fVertex);
 
-      if (index2 != index) continue;
-
-      // found common particle
-      d1 -= track->Pt();
-
-      if (!track2Found) {
-        AliVParticle *MCpart = jet2->Track(iTrack2);
-        AliDebug(3,Form("Track %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-            iTrack,track->Pt(),track->Eta(),track->Phi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
-        d2 -= MCpart->Pt();
-      }
+      for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+        Int_t cellId = clus->GetCellAbsId(iCell);
+        Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
 
-      track2Found = kTRUE;
-    }
+        Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(cellId));
+        MClabel -= fMCLabelShift;
+        if (MClabel <= 0) continue;
 
-    // now look for common particles in the cluster array
-    if (fUseCellsToMatch && fCaloCells) { // if the cell colection is available, look for cells with a matched MC particle
-      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
-        AliVCluster *clus = jet1->Cluster(iClus);
-        if (!clus) {
-          AliWarning(Form("Could not find cluster %d!", iClus));
+        Int_t index1 = -1;
+        index1 = tracks2->GetIndexFromLabel(MClabel);
+        if (index1 < 0) {
+          AliDebug(3,Form("Cell %d (frac = %f) does not have an associated MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
           continue;
         }
-        AliTLorentzVector part;
-        clus->GetMomentum(part, fVertex);
-
-        for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
-          Int_t cellId = clus->GetCellAbsId(iCell);
-          Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
-
-          Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(cellId));
-          MClabel -= fMCLabelShift;
-          if (MClabel <= 0) continue;
-
-          Int_t index1 = -1;
-          index1 = tracks2->GetIndexFromLabel(MClabel);
-          if (index1 < 0) {
-            AliDebug(3,Form("Cell %d (frac = %f) does not have an associated MC particle (MClabel = %d)!",iCell,cellFrac,MClabel));
-            continue;
-          }
-
-          if (index2 != index1) continue;
 
-          // found common particle
-          d1 -= part.Pt() * cellFrac;
-
-          if (!track2Found) { // only if it is not already found among charged tracks (charged particles are most likely already found)
-            AliVParticle *MCpart = jet2->Track(iTrack2);
-            AliDebug(3,Form("Cell %d belonging to cluster %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-                iCell,iClus,part.Pt(),part.Eta(),part.Phi_0_2pi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
-            d2 -= MCpart->Pt() * cellFrac;
-          }
-
-          track2Found = kTRUE;
-        }
+        shared.fTracks.push_back(std::make_pair(index1, Int_t(shared.fPtShared.size())));
+        shared.fPtShared.push_back(part.Pt() * cellFrac);
+        shared.fFraction.push_back(cellFrac);
       }
     }
-    else { //otherwise look for the first contributor to the cluster, and if matched to a MC label remove it
-      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
-        AliVCluster *clus = jet1->Cluster(iClus);
-        if (!clus) {
-          AliWarning(Form("Could not find cluster %d!", iClus));
-          continue;
-        }
-        AliTLorentzVector part;
-        clus->GetMomentum(part, fVertex);
+  }
+  else { //otherwise look for the first contributor to the cluster, and if matched to a MC label remove it
+    for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+      AliVCluster *clus = jet1->Cluster(iClus);
+      if (!clus) {
+        AliWarning(Form("Could not find cluster %d!", iClus));
+        continue;
+      }
+      AliTLorentzVector part;
+      clus->GetMomentum(part, fVertex);
 
-        Int_t MClabel = TMath::Abs(clus->GetLabel());
-        MClabel -= fMCLabelShift;
-        if (MClabel <= 0) continue;
+      Int_t MClabel = TMath::Abs(clus->GetLabel());
+      MClabel -= fMCLabelShift;
+      if (MClabel <= 0) continue;
 
-        Int_t index = -1;
-        index = tracks2->GetIndexFromLabel(MClabel);
+      Int_t index = -1;
+      index = tracks2->GetIndexFromLabel(MClabel);
 
-        if (index < 0) {
-          AliDebug(3,Form("Cluster %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
-          continue;
-        }
+      if (index < 0) {
+        AliDebug(3,Form("Cluster %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iClus,part.Pt(),MClabel));
+        continue;
+      }
 
-        if (index2 != index) continue;
+      shared.fTracks.push_back(std::make_pair(index, Int_t(shared.fPtShared.size())));
+      shared.fPtShared.push_back(part.Pt());
+      shared.fFraction.push_back(1.);
+    }
+  }
 
-        // found common particle
-        d1 -= part.Pt();
+  // sorted by particle index, contributions to the same particle stay in their order
+  std::sort(shared.fTracks.begin(), shared.fTracks.end());
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::GetMCLabelMatchingLevel(const SharedConstituents &shared, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const
+{
+  // d1 and d2 represent the matching level: 0 = maximum level of matching, 1 = the two jets are completely unrelated
+  d1 = shared.fPt;
+  d2 = jet2->Pt();
 
-        if (!track2Found) { // only if it is not already found among charged tracks (charged particles are most likely already found)
-          AliVParticle *MCpart = jet2->Track(iTrack2);
-          AliDebug(3,Form("Cluster %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-              iClus,part.Pt(),part.Eta(),part.Phi_0_2pi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
+  for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+    Bool_t track2Found = kFALSE;
+    Int_t index2 = jet2->TrackAt(iTrack2);
 
-          d2 -= MCpart->Pt();
-        }
+    // common particles, first the tracks then the clusters (or cells) of jet 1
+    std::vector<std::pair<Int_t, Int_t> >::const_iterator common = std::lower_bound(shared.fTracks.begin(), shared.fTracks.end(), std::make_pair(index2, -1));
+    for (; common != shared.fTracks.end() && common->first == index2; ++common) {
+      d1 -= shared.fPtShared[common->second];
 
-        track2Found = kTRUE;
+      if (!track2Found) { // only the first contribution is removed from jet 2 (charged particles are most likely found first)
+        AliVParticle *MCpart = jet2->Track(iTrack2);
+        AliDebug(3,Form("Contribution %d is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
+            common->second,index2,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
+        d2 -= MCpart->Pt() * shared.fFraction[common->second];
       }
+
+      track2Found = kTRUE;
     }
   }
 
@@ -1659,10 +1818,10 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
   if (d2 < 0)
     d2 = 0;
 
-  if (totalPt1 < 1)
+  if (shared.fTotalPt < 1)
     d1 = -1;
   else
-    d1 /= totalPt1;
+    d1 /= shared.fTotalPt;
 
   if (jet2->Pt() < 1)
     d2 = -1;
@@ -1678,6 +1837,39 @@ void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, Ali
 
   if (!jets1 || !jets1->GetArray() || !jets2 || !jets2->GetArray()) return;
 
+  SharedConstituents shared;
+  GetSameCollectionsSharedConstituents(jet1, shared);
+  GetSameCollectionsMatchingLevel(jet1, shared, jet2, d1, d2);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::GetSameCollectionsSharedConstituents(AliEmcalJet *jet1, SharedConstituents &shared) const
+{
+  // Constituents of jet1 sorted by their index in the collections, with their position in the jet.
+
+  shared.Clear();
+  shared.fPt = jet1->Pt();
+  shared.fTotalPt = shared.fPt;
+
+  shared.fTracks.reserve(jet1->GetNumberOfTracks());
+  for (Int_t iTrack1 = 0; iTrack1 < jet1->GetNumberOfTracks(); iTrack1++) {
+    shared.fTracks.push_back(std::make_pair(jet1->TrackAt(iTrack1), iTrack1));
+  }
+  std::sort(shared.fTracks.begin(), shared.fTracks.end());
+
+  shared.fClusters.reserve(jet1->GetNumberOfClusters());
+  for (Int_t iClus1 = 0; iClus1 < jet1->GetNumberOfClusters(); iClus1++) {
+    shared.fClusters.push_back(std::make_pair(jet1->ClusterAt(iClus1), iClus1));
+  }
+  std::sort(shared.fClusters.begin(), shared.fClusters.end());
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, const SharedConstituents &shared, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const
+{ 
+  AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+
   // All of the containers are simply used as proxies for whether tracks or clusters are in a jet
   AliParticleContainer *tracks1   = jets1->GetParticleContainer();
   AliClusterContainer  *clusters1 = jets1->GetClusterContainer();
@@ -1692,24 +1884,24 @@ void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, Ali
 
     for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
       Int_t index2 = jet2->TrackAt(iTrack2);
-      for (Int_t iTrack1 = 0; iTrack1 < jet1->GetNumberOfTracks(); iTrack1++) {
-        Int_t index1 = jet1->TrackAt(iTrack1);
-        if (index2 == index1) { // found common particle
-          AliVParticle *part1 = jet1->Track(iTrack1);
-          if (!part1) {
-            AliWarning(Form("Could not find track %d!", index1));
-            continue;
-          }
-          AliVParticle *part2 = jet2->Track(iTrack2);
-          if (!part2) {
-            AliWarning(Form("Could not find track %d!", index2));
-            continue;
-          }
-
-          d1 -= part1->Pt();
-          d2 -= part2->Pt();
-          break;
+      // tracks of jet1 with the same index, in the order in which they appear in jet1
+      std::vector<std::pair<Int_t, Int_t> >::const_iterator common = std::lower_bound(shared.fTracks.begin(), shared.fTracks.end(), std::make_pair(index2, -1));
+      for (; common != shared.fTracks.end() && common->first == index2; ++common) { // found common particle
+        Int_t index1 = common->first;
+        AliVParticle *part1 = jet1->Track(common->second);
+        if (!part1) {
+          AliWarning(Form("Could not find track %d!", index1));
+          continue;
+        }
+        AliVParticle *part2 = jet2->Track(iTrack2);
+        if (!part2) {
+          AliWarning(Form("Could not find track %d!", index2));
+          continue;
         }
+
+        d1 -= part1->Pt();
+        d2 -= part2->Pt();
+        break;
       }
     }
 
@@ -1822,27 +2014,26 @@ void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, Ali
     else {
       for (Int_t iClus2 = 0; iClus2 < jet2->GetNumberOfClusters(); iClus2++) {
         Int_t index2 = jet2->ClusterAt(iClus2);
-        for (Int_t iClus1 = 0; iClus1 < jet1->GetNumberOfClusters(); iClus1++) {
-          Int_t index1 = jet1->ClusterAt(iClus1);
-          if (index2 == index1) { // found common particle
-            AliVCluster *clus1 = jet1->Cluster(iClus1);
-            if (!clus1) {
-              AliWarning(Form("Could not find cluster %d!", index1));
-              continue;
-            }
-            AliVCluster *clus2 =  jet2->Cluster(iClus2);
-            if (!clus2) {
-              AliWarning(Form("Could not find cluster %d!", index2));
-              continue;
-            }
-            TLorentzVector part1, part2;
-            clus1->GetMomentum(part1, fVertex);
-            clus2->GetMomentum(part2, fVertex);
-
-            d1 -= part1.Pt();
-            d2 -= part2.Pt();
-            break;
+        std::vector<std::pair<Int_t, Int_t> >::const_iterator common = std::lower_bound(shared.fClusters.begin(), shared.fClusters.end(), std::make_pair(index2, -1));
+        for (; common != shared.fClusters.end() && common->first == index2; ++common) { // found common particle
+          Int_t index1 = common->first;
+          AliVCluster *clus1 = jet1->Cluster(common->second);
+          if (!clus1) {
+            AliWarning(Form("Could not find cluster %d!", index1));
+            continue;
           }
+          AliVCluster *clus2 =  jet2->Cluster(iClus2);
+          if (!clus2) {
+            AliWarning(Form("Could not find cluster %d!", index2));
+            continue;
+          }
+          TLorentzVector part1, part2;
+          clus1->GetMomentum(part1, fVertex);
+          clus2->GetMomentum(part2, fVertex);
+
+          d1 -= part1.Pt();
+          d2 -= part2.Pt();
+          break;
         }
       }
     }
@@ -1886,6 +2077,12 @@ void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2,
     ;
   }
 
+  SetMatchingLevel(jet1, jet2, d1, d2);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2) 
+{
   if (d1 >= 0) {
 
     if (d1 < jet1->ClosestJetDistance()) {
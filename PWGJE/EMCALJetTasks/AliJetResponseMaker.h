@@ -23,6 +23,10 @@ class TClonesArray;
 class TH2;
 class THnSparse;
 class AliNamedArrayI;
+class AliJetContainer;
+
+#include <utility>
+#include <vector>
 
 #include "AliEmcalJet.h"
 #include "AliAnalysisTaskEmcalJet.h"
@@ -96,10 +100,31 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Bool_t                      FillHistograms();
   Bool_t                      Run();
   Bool_t                      DoJetMatching();
+  /// Constituents of a jet 1 which can be shared with jets 2, sorted by index in the jet 2 containers,
+  /// so that the common constituents of a pair are found without looping over both jets
+  struct SharedConstituents {
+    SharedConstituents() : fPt(0), fTotalPt(0), fTracks(), fClusters(), fPtShared(), fFraction() {}
+    void Clear() { fPt = 0; fTotalPt = 0; fTracks.clear(); fClusters.clear(); fPtShared.clear(); fFraction.clear(); }
+
+    Double_t                                fPt;       ///< jet 1 pt without the constituents that cannot be matched (MC label)
+    Double_t                                fTotalPt;  ///< normalisation of the jet 1 matching level (MC label)
+    std::vector<std::pair<Int_t, Int_t> >   fTracks;   ///< (index in jet 2 container, track or contribution number)
+    std::vector<std::pair<Int_t, Int_t> >   fClusters; ///< (index in jet 2 container, cluster number) (same collections)
+    std::vector<Double_t>                   fPtShared; ///< pt removed from jet 1 for each contribution (MC label)
+    std::vector<Double_t>                   fFraction; ///< fraction of the jet 2 particle pt removed for each contribution (MC label)
+  };
+
   void                        SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, MatchingType matching);
+  void                        SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2);
   void                        GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const;
   void                        GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
+  void                        GetMCLabelMatchingLevel(const SharedConstituents &shared, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
+  void                        GetMCLabelSharedConstituents(AliEmcalJet *jet1, SharedConstituents &shared) const;
   void                        GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
+  void                        GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, const SharedConstituents &shared, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
+  void                        GetSameCollectionsSharedConstituents(AliEmcalJet *jet1, SharedConstituents &shared) const;
+  Bool_t                      IndexJets2(AliJetContainer *jets2);
+  void                        GetJets2Candidates(AliEmcalJet *jet1, const SharedConstituents &shared, std::vector<Int_t> &candidates) const;
   void                        FillMatchingHistos(AliEmcalJet* jet1, AliEmcalJet* jet2, Double_t d, Double_t CE1, Double_t CE2);
   void                        FillJetHisto(AliEmcalJet* jet, Int_t Set);
   void                        AllocateTH2();
@@ -125,6 +150,15 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Int_t                       fDBCAxis;                                // add DBC (number of soft dropped branches) axis in matching THnSparse (default=0)
   Int_t                       fJetRelativeEPAngle;                     ///< add jet angle relative to the EP in matching THnSparse (default=0)
 
+  // Index of jets 2 restricting the pairs tested in DoJetLoop
+  std::vector<std::vector<Int_t> > fJets2ByCell;                       //!<! jets 2 in each (eta,phi) cell (geometrical matching)
+  std::vector<std::vector<Int_t> > fJets2ByTrack;                      //!<! jets 2 containing each track (MC label, same collections)
+  std::vector<std::vector<Int_t> > fJets2ByCluster;                    //!<! jets 2 containing each cluster (same collections)
+  Double_t                    fJets2EtaMin;                            //!<! lower eta edge of the cells
+  Double_t                    fJets2CellSize;                          //!<! eta size of the cells
+  Int_t                       fJets2NEta;                              //!<! number of cells in eta
+  Int_t                       fJets2NPhi;                              //!<! number of cells in phi
+
   Bool_t                      fIsJet1Rho;                              //!whether the jet1 collection has to be average subtracted
   Bool_t                      fIsJet2Rho;                              //!whether the jet2 collection has to be average subtracted
 
@@ -63,6 +63,9 @@ class AliESDv0;
 class AliAODv0;
 
 #include <Riostream.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
 #include "TList.h"
 #include "TH1.h"
 #include "TH2.h"
@@ -475,11 +478,27 @@ fTreeCascVarMagneticField(0),
 fHistEventCounter(0),
 fHistEventCounterDifferential(0),
 fHistCentrality(0),
-fHistEventMatrix(0)
+fHistEventMatrix(0),
+//Compiled configuration lookup
+fV0Configs(),
+fV0Histos(),
+fV0CutKeys(),
+fV0CutOrder(),
+fCascadeConfigs(),
+fCascadeHistos(),
+fCascadeCutKeys(),
+fCascadeCutOrder(),
+fSelectedConfigs(),
+fFillConfig(),
+fFillPt(),
+fFillMass(),
+fFillOrder(),
+fFillOffset()
 //------------------------------------------------
 // Tree Variables
 {
-    
+    for(Int_t ilist=0; ilist<4; ilist++) fV0ListBegin[ilist] = 0;
+    for(Int_t ilist=0; ilist<5; ilist++) fCascadeListBegin[ilist] = 0;
 }
 
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2(Bool_t lSaveEventTree, Bool_t lSaveV0Tree, Bool_t lSaveCascadeTree, const char *name, TString lExtraOptions)
@@ -835,8 +854,25 @@ fTreeCascVarMagneticField(0),
 fHistEventCounter(0),
 fHistEventCounterDifferential(0),
 fHistCentrality(0),
-fHistEventMatrix(0)
+fHistEventMatrix(0),
+//Compiled configuration lookup
+fV0Configs(),
+fV0Histos(),
+fV0CutKeys(),
+fV0CutOrder(),
+fCascadeConfigs(),
+fCascadeHistos(),
+fCascadeCutKeys(),
+fCascadeCutOrder(),
+fSelectedConfigs(),
+fFillConfig(),
+fFillPt(),
+fFillMass(),
+fFillOrder(),
+fFillOffset()
 {
+    for(Int_t ilist=0; ilist<4; ilist++) fV0ListBegin[ilist] = 0;
+    for(Int_t ilist=0; ilist<5; ilist++) fCascadeListBegin[ilist] = 0;
     
     //Re-vertex: Will only apply for cascade candidates
     
@@ -1866,6 +1902,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     Int_t nv0s = 0;
     nv0s = lESDevent->GetNumberOfV0s();
     
+    //Superlight mode: (re-)compile configuration lookup if configurations were added
+    if( (Long_t)fV0Configs.size() != fListK0Short->GetEntries()+fListLambda->GetEntries()+fListAntiLambda->GetEntries() )
+        CompileV0Configurations();
+    
     for (Int_t iV0 = 0; iV0 < nv0s; iV0++) //extra-crazy test
     {   // This is the begining of the V0 loop
         AliESDv0 *v0 = ((AliESDEvent*)lESDevent)->GetV0(iV0);
@@ -2210,29 +2250,26 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
         AliV0Result *lV0Result = 0x0;
         
-        //pointers to valid results
-        AliV0Result *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        for( Int_t icfg=0; icfg<fListK0Short->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListK0Short->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListLambda->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListAntiLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListAntiLambda->At(icfg);
-            lValidConfigurations++;
-        }
-        
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lV0Result = lPointers[lcfg];
-            histoout  = lV0Result->GetHistogram();
+        //Only configurations passing all indexed thresholds need to be checked in detail
+        //(same order of cuts as in CompileV0Configurations)
+        Double_t lV0CutValues[7] = {
+            fTreeVariableV0Radius,
+            -fTreeVariableV0Radius,
+            fTreeVariableDcaNegToPrimVertex,
+            fTreeVariableDcaPosToPrimVertex,
+            -fTreeVariableDcaV0Daughters,
+            fTreeVariableV0CosineOfPointingAngle,
+            (Double_t) fTreeVariableLeastNbrCrossedRows
+        };
+        fSelectedConfigs.clear();
+        for( Int_t ilist=0; ilist<3; ilist++ )
+            SelectConfigurations(fV0CutKeys, fV0CutOrder, fV0Configs.size(), 7, fV0ListBegin[ilist], fV0ListBegin[ilist+1], lV0CutValues);
+        
+        for(UInt_t lsel=0; lsel<fSelectedConfigs.size(); lsel++){
+            Int_t lcfg = fSelectedConfigs[lsel];
+            lV0Result = fV0Configs[lcfg];
             
             Float_t lMass = 0;
             Float_t lRap  = 0;
@@ -2379,8 +2416,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                  )
                 )//end major if
             {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
+                //This satisfies all my conditionals! Fill histogram (after the V0 loop)
+                fFillConfig.push_back( lcfg );
+                fFillPt.push_back( fTreeVariablePt );
+                fFillMass.push_back( lMass );
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -2389,6 +2428,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         
     }// This is the end of the V0 loop
     
+    FillBufferedHistograms(fV0Histos);
+    
     //------------------------------------------------
     // Rerun cascade vertexer!
     //------------------------------------------------
@@ -2424,6 +2465,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     
     Bool_t lValidXiMinus, lValidXiPlus, lValidOmegaMinus, lValidOmegaPlus;
     
+    //Superlight mode: (re-)compile configuration lookup if configurations were added
+    if( (Long_t)fCascadeConfigs.size() != fListXiMinus->GetEntries()+fListXiPlus->GetEntries()+fListOmegaMinus->GetEntries()+fListOmegaPlus->GetEntries() )
+        CompileCascadeConfigurations();
+    
     for (Int_t iXi = 0; iXi < ncascades; iXi++) {
         
         //------------------------------------------------
@@ -3264,38 +3309,32 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
         //Step 1: Sweep members of the output object TLists and fill all of them as appropriate
-        TH3F *histoout         = 0x0;
         AliCascadeResult *lCascadeResult = 0x0;
         
-        //pointers to valid results
-        AliCascadeResult *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        if( lValidXiMinus )
-            for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidXiPlus )
-            for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaMinus )
-            for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaPlus )
-            for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lCascadeResult = lPointers[lcfg];
+        //Only configurations of valid lists passing all indexed thresholds need to be checked in detail
+        //(same order of cuts as in CompileCascadeConfigurations)
+        Double_t lCascadeCutValues[10] = {
+            fTreeCascVarDCANegToPrimVtx,
+            fTreeCascVarDCAPosToPrimVtx,
+            fTreeCascVarDCABachToPrimVtx,
+            fTreeCascVarDCAV0ToPrimVtx,
+            fTreeCascVarV0Radius,
+            fTreeCascVarCascRadius,
+            -fTreeCascVarDCAV0Daughters,
+            -fTreeCascVarDCACascDaughters,
+            fTreeCascVarV0CosPointingAngle,
+            fTreeCascVarCascCosPointingAngle
+        };
+        Bool_t lValidList[4] = { lValidXiMinus, lValidXiPlus, lValidOmegaMinus, lValidOmegaPlus };
+        fSelectedConfigs.clear();
+        for( Int_t ilist=0; ilist<4; ilist++ )
+            if( lValidList[ilist] )
+                SelectConfigurations(fCascadeCutKeys, fCascadeCutOrder, fCascadeConfigs.size(), 10, fCascadeListBegin[ilist], fCascadeListBegin[ilist+1], lCascadeCutValues);
+        
+        for(UInt_t lsel=0; lsel<fSelectedConfigs.size(); lsel++){
+            Int_t lcfg = fSelectedConfigs[lsel];
+            lCascadeResult = fCascadeConfigs[lcfg];
             Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
-            histoout  = lCascadeResult->GetHistogram();
             
             Float_t lMass = 0;
             Float_t lV0Mass = 0;
@@ -3635,9 +3674,11 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                  )
                 )//end major if
             {
-                //This satisfies all my conditionals! Fill histogram
+                //This satisfies all my conditionals! Fill histogram (after the cascade loop)
                 if( lTheOne && fkSaveSpecificConfig ) fTreeCascade->Fill();
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
+                fFillConfig.push_back( lcfg );
+                fFillPt.push_back( fTreeCascVarPt );
+                fFillMass.push_back( lMass );
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -3646,6 +3687,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         
     }// end of the Cascade loop (ESD or AOD)
     
+    FillBufferedHistograms(fCascadeHistos);
+    
     // Post output data.
     //Regular Output: Slots 1-8
     PostData(1, fListHist    );
@@ -3766,6 +3809,153 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CompileV0Configurations()
+{
+    //Collect all V0 configurations and sort their thresholds for the indexed cuts.
+    //Each key is defined such that a candidate can only pass if key < value:
+    // 0: V0 radius > min, 1: V0 radius < max, 2: DCA neg to PV, 3: DCA pos to PV,
+    // 4: DCA V0 daughters (negated), 5: V0 CosPA (variable cut can only be tighter),
+    // 6: least number of crossed rows
+    const Int_t lNCuts = 7;
+    TList *lLists[3] = { fListK0Short, fListLambda, fListAntiLambda };
+    fV0Configs.clear();
+    fV0Histos.clear();
+    for( Int_t ilist=0; ilist<3; ilist++ ){
+        fV0ListBegin[ilist] = fV0Configs.size();
+        for( Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++ ){
+            AliV0Result *lV0Result = (AliV0Result*) lLists[ilist]->At(icfg);
+            fV0Configs.push_back( lV0Result );
+            fV0Histos.push_back( lV0Result->GetHistogram() );
+        }
+    }
+    fV0ListBegin[3] = fV0Configs.size();
+    
+    Int_t lNConfigs = fV0Configs.size();
+    fV0CutKeys.resize( lNCuts*lNConfigs );
+    fV0CutOrder.resize( lNCuts*lNConfigs );
+    std::vector< std::pair<Double_t,Int_t> > lSorted;
+    for( Int_t icut=0; icut<lNCuts; icut++ ){
+        for( Int_t ilist=0; ilist<3; ilist++ ){
+            lSorted.clear();
+            for( Int_t icfg=fV0ListBegin[ilist]; icfg<fV0ListBegin[ilist+1]; icfg++ ){
+                AliV0Result *lV0Result = fV0Configs[icfg];
+                Double_t lKey = 0;
+                if( icut == 0 ) lKey = lV0Result->GetCutV0Radius();
+                if( icut == 1 ) lKey = -lV0Result->GetCutMaxV0Radius();
+                if( icut == 2 ) lKey = lV0Result->GetCutDCANegToPV();
+                if( icut == 3 ) lKey = lV0Result->GetCutDCAPosToPV();
+                if( icut == 4 ) lKey = -lV0Result->GetCutDCAV0Daughters();
+                if( icut == 5 ) lKey = (Float_t) lV0Result->GetCutV0CosPA();
+                if( icut == 6 ) lKey = lV0Result->GetCutLeastNumberOfCrossedRows();
+                lSorted.push_back( std::make_pair(lKey, icfg) );
+            }
+            std::sort( lSorted.begin(), lSorted.end() );
+            for( UInt_t i=0; i<lSorted.size(); i++ ){
+                fV0CutKeys [icut*lNConfigs+fV0ListBegin[ilist]+i] = lSorted[i].first;
+                fV0CutOrder[icut*lNConfigs+fV0ListBegin[ilist]+i] = lSorted[i].second;
+            }
+        }
+    }
+    AliInfo(Form("Compiled lookup for %i V0 configurations",lNConfigs));
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CompileCascadeConfigurations()
+{
+    //Collect all cascade configurations and sort their thresholds for the indexed cuts.
+    //Each key is defined such that a candidate can only pass if key < value:
+    // 0-3: DCA neg/pos/bachelor/V0 to PV, 4: V0 radius, 5: cascade radius,
+    // 6: DCA V0 daughters (negated), 7: DCA cascade daughters (negated, variable cut can only be tighter),
+    // 8: V0 CosPA, 9: cascade CosPA (variable cuts can only be tighter)
+    const Int_t lNCuts = 10;
+    TList *lLists[4] = { fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus };
+    fCascadeConfigs.clear();
+    fCascadeHistos.clear();
+    for( Int_t ilist=0; ilist<4; ilist++ ){
+        fCascadeListBegin[ilist] = fCascadeConfigs.size();
+        for( Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++ ){
+            AliCascadeResult *lCascadeResult = (AliCascadeResult*) lLists[ilist]->At(icfg);
+            fCascadeConfigs.push_back( lCascadeResult );
+            fCascadeHistos.push_back( lCascadeResult->GetHistogram() );
+        }
+    }
+    fCascadeListBegin[4] = fCascadeConfigs.size();
+    
+    Int_t lNConfigs = fCascadeConfigs.size();
+    fCascadeCutKeys.resize( lNCuts*lNConfigs );
+    fCascadeCutOrder.resize( lNCuts*lNConfigs );
+    std::vector< std::pair<Double_t,Int_t> > lSorted;
+    for( Int_t icut=0; icut<lNCuts; icut++ ){
+        for( Int_t ilist=0; ilist<4; ilist++ ){
+            lSorted.clear();
+            for( Int_t icfg=fCascadeListBegin[ilist]; icfg<fCascadeListBegin[ilist+1]; icfg++ ){
+                AliCascadeResult *lCascadeResult = fCascadeConfigs[icfg];
+                Double_t lKey = 0;
+                if( icut == 0 ) lKey = lCascadeResult->GetCutDCANegToPV();
+                if( icut == 1 ) lKey = lCascadeResult->GetCutDCAPosToPV();
+                if( icut == 2 ) lKey = lCascadeResult->GetCutDCABachToPV();
+                if( icut == 3 ) lKey = lCascadeResult->GetCutDCAV0ToPV();
+                if( icut == 4 ) lKey = lCascadeResult->GetCutV0Radius();
+                if( icut == 5 ) lKey = lCascadeResult->GetCutCascRadius();
+                if( icut == 6 ) lKey = -lCascadeResult->GetCutDCAV0Daughters();
+                if( icut == 7 ) lKey = -((Float_t) lCascadeResult->GetCutDCACascDaughters());
+                if( icut == 8 ) lKey = (Float_t) lCascadeResult->GetCutV0CosPA();
+                if( icut == 9 ) lKey = (Float_t) lCascadeResult->GetCutCascCosPA();
+                lSorted.push_back( std::make_pair(lKey, icfg) );
+            }
+            std::sort( lSorted.begin(), lSorted.end() );
+            for( UInt_t i=0; i<lSorted.size(); i++ ){
+                fCascadeCutKeys [icut*lNConfigs+fCascadeListBegin[ilist]+i] = lSorted[i].first;
+                fCascadeCutOrder[icut*lNConfigs+fCascadeListBegin[ilist]+i] = lSorted[i].second;
+            }
+        }
+    }
+    AliInfo(Form("Compiled lookup for %i cascade configurations",lNConfigs));
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::SelectConfigurations(const std::vector<Double_t> &lKeys, const std::vector<Int_t> &lOrder, Int_t lNConfigs, Int_t lNCuts, Int_t lBegin, Int_t lEnd, const Double_t *lValues)
+{
+    //Append the configurations of list [lBegin, lEnd) that pass the most selective indexed cut,
+    //in their original order. All cuts are still checked in detail afterwards.
+    if( lEnd <= lBegin ) return;
+    Int_t lBestCut = -1;
+    Long_t lBestCount = lEnd-lBegin;
+    for( Int_t icut=0; icut<lNCuts; icut++ ){
+        const Double_t *lFirst = &lKeys[icut*lNConfigs+lBegin];
+        Long_t lCount = std::lower_bound( lFirst, lFirst+(lEnd-lBegin), lValues[icut] ) - lFirst;
+        if( lCount < lBestCount || lBestCut < 0 ){
+            lBestCut = icut;
+            lBestCount = lCount;
+        }
+        if( lBestCount == 0 ) return;
+    }
+    UInt_t lFirstSelected = fSelectedConfigs.size();
+    for( Long_t i=0; i<lBestCount; i++ )
+        fSelectedConfigs.push_back( lOrder[lBestCut*lNConfigs+lBegin+i] );
+    std::sort( fSelectedConfigs.begin()+lFirstSelected, fSelectedConfigs.end() );
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FillBufferedHistograms(const std::vector<TH3F*> &lHistos)
+{
+    //Fill the buffered entries histogram by histogram, keeping the candidate order within each
+    Int_t lNFills = fFillConfig.size();
+    fFillOffset.assign( lHistos.size()+1, 0 );
+    for( Int_t i=0; i<lNFills; i++ ) fFillOffset[fFillConfig[i]+1]++;
+    for( UInt_t icfg=0; icfg<lHistos.size(); icfg++ ) fFillOffset[icfg+1] += fFillOffset[icfg];
+    fFillOrder.resize( lNFills );
+    for( Int_t i=0; i<lNFills; i++ ) fFillOrder[fFillOffset[fFillConfig[i]]++] = i;
+    for( Int_t i=0; i<lNFills; i++ ){
+        Int_t lFill = fFillOrder[i];
+        lHistos[fFillConfig[lFill]] -> Fill ( fCentrality, fFillPt[lFill], fFillMass[lFill] );
+    }
+    fFillConfig.clear();
+    fFillPt.clear();
+    fFillMass.clear();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
@@ -48,6 +48,7 @@ class AliExternalTrackParam;
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 #include "AliEventCuts.h"
 
@@ -220,6 +221,12 @@ public:
     void AddStandardCascadeConfiguration(Bool_t lUseFull = kFALSE, Bool_t lDoSystematics = kTRUE);
     void AddCascadeConfiguration276TeV(); //Adds old 2.76 PbPb cut level analyses
     void AddCascadeConfigurationPreliminaryCrosscheck(); //
+//---------------------------------------------------------------------------------------
+    //Superlight mode: threshold lookup of configurations, rebuilt whenever configurations change
+    void CompileV0Configurations();
+    void CompileCascadeConfigurations();
+    void SelectConfigurations(const std::vector<Double_t> &lKeys, const std::vector<Int_t> &lOrder, Int_t lNConfigs, Int_t lNCuts, Int_t lBegin, Int_t lEnd, const Double_t *lValues);
+    void FillBufferedHistograms(const std::vector<TH3F*> &lHistos);
 //---------------------------------------------------------------------------------------
     Float_t GetDCAz(AliESDtrack *lTrack);
     Float_t GetCosPA(AliESDtrack *lPosTrack, AliESDtrack *lNegTrack, AliESDEvent *lEvent);
@@ -660,10 +667,34 @@ private:
     TH1D *fHistCentrality; //!
     TH2D *fHistEventMatrix; //!
 
+//===========================================================================================
+//   Superlight mode: compiled configuration lookup
+//===========================================================================================
+    // For every indexed cut, the thresholds of all configurations of a list are sorted such that
+    // a candidate passes the cut for exactly the first n entries (key < value): one binary search
+    // per cut yields the configurations worth checking in detail.
+    std::vector<AliV0Result*> fV0Configs;             //! K0Short, Lambda and AntiLambda configurations
+    std::vector<TH3F*> fV0Histos;                     //! output histogram of each V0 configuration
+    std::vector<Double_t> fV0CutKeys;                 //! sorted thresholds per indexed cut and list
+    std::vector<Int_t> fV0CutOrder;                   //! configuration belonging to each entry of fV0CutKeys
+    Int_t fV0ListBegin[4];                            //! first configuration of each list in fV0Configs
+    std::vector<AliCascadeResult*> fCascadeConfigs;   //! XiMinus, XiPlus, OmegaMinus and OmegaPlus configurations
+    std::vector<TH3F*> fCascadeHistos;                //! output histogram of each cascade configuration
+    std::vector<Double_t> fCascadeCutKeys;            //! sorted thresholds per indexed cut and list
+    std::vector<Int_t> fCascadeCutOrder;              //! configuration belonging to each entry of fCascadeCutKeys
+    Int_t fCascadeListBegin[5];                       //! first configuration of each list in fCascadeConfigs
+    std::vector<Int_t> fSelectedConfigs;              //! configurations to be checked for the current candidate
+    // Histogram fills of one event, applied configuration by configuration at the end of the candidate loop
+    std::vector<Int_t> fFillConfig;                   //! configuration
+    std::vector<Float_t> fFillPt;                     //! candidate pt
+    std::vector<Float_t> fFillMass;                   //! candidate invariant mass
+    std::vector<Int_t> fFillOrder;                    //! fills ordered by configuration
+    std::vector<Int_t> fFillOffset;                   //! first fill of each configuration in fFillOrder
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 4);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 5);
     //1: first implementation
 };
 
@@ -50,6 +50,7 @@ class AliAODv0;
 #include "TVector3.h"
 #include "TCanvas.h"
 #include "TMath.h"
+#include "TArrayD.h"
 #include "TLegend.h"
 #include "TRandom3.h"
 #include "TLorentzVector.h"
@@ -675,6 +676,16 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (esdTrack->GetSign() > 0. && TMath::Abs(d)>fV0VertexerSels[2]) pos[npos++]=i;
     }
     
+    //Pre-compute XY helix circles once per track instead of once per pair
+    //Only valid if the tracks are not replaced or moved before the DCA minimization
+    Bool_t lUseXYPrefilter = !fkUseOptimalTrackParams && !fkResetInitialPositions;
+    TArrayD negCircle(lUseXYPrefilter ? 5*nneg : 0);
+    TArrayD posCircle(lUseXYPrefilter ? 5*npos : 0);
+    if( lUseXYPrefilter ){
+        for (i=0; i<nneg; i++) GetHelixCircle(event->GetTrack(neg[i]), negCircle.GetArray()+5*i, b);
+        for (i=0; i<npos; i++) GetHelixCircle(event->GetTrack(pos[i]), posCircle.GetArray()+5*i, b);
+    }
+    
       int nHypSel = fV0HypSelArray ? fV0HypSelArray->GetEntriesFast() : 0;
     
     for (i=0; i<nneg; i++) {
@@ -694,6 +705,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             
             fHistV0Statistics->Fill(1.5); //pass distance to PV
             
+            //Cheap XY rejection before copying and propagating track parameters
+            if( lUseXYPrefilter && !IsV0PairXYCompatible(negCircle.GetArray()+5*i, posCircle.GetArray()+5*k) ) continue;
+            
             AliExternalTrackParam nt(*ntrk), pt(*ptrk);
             Bool_t lUsedOptimalParams = kFALSE;
             
@@ -2860,6 +2874,56 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     return;
 }
 
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(const AliExternalTrackParam *track,Double_t circle[5], Double_t b){
+    // Center and radius of the track helix in XY, plus the Y and Z
+    // uncertainties entering the weighed DCA, as used in Tracks2V0vertices
+    Double_t helix[6];
+    track->GetHelixParameters(helix,b);
+    GetHelixCenter( track, circle, b );
+    circle[2] = TMath::Abs(1./helix[4]);
+    circle[3] = track->GetSigmaY2();
+    circle[4] = track->GetSigmaZ2();
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsV0PairXYCompatible(const Double_t lNegCircle[5], const Double_t lPosCircle[5]) const{
+    // Returns kFALSE only for pairs that the DCA between daughters would
+    // reject anyway: the result of the V0 finding is not changed
+    Double_t xNegCenter = lNegCircle[0];
+    Double_t yNegCenter = lNegCircle[1];
+    Double_t NegRadius = lNegCircle[2];
+    Double_t xPosCenter = lPosCircle[0];
+    Double_t yPosCenter = lPosCircle[1];
+    Double_t PosRadius = lPosCircle[2];
+    
+    Double_t lDist = TMath::Sqrt(
+                                 TMath::Power( xNegCenter - xPosCenter , 2) +
+                                 TMath::Power( yNegCenter - yPosCenter , 2)
+                                 );
+    
+    if( fkDoImprovedDCAV0DauPropagation ){
+        //Same fast skipper as in GetDCAV0Dau, on the same circles
+        if ( fkSkipLargeXYDCA ) {
+            if( lDist > NegRadius + PosRadius + 2*fV0VertexerSels[3] ) return kFALSE;
+            if( lDist < TMath::Abs(NegRadius - PosRadius) - 2*fV0VertexerSels[3] ) return kFALSE;
+        }
+        return kTRUE;
+    }
+    
+    //Old call: GetDCA returns sqrt(dm*sqrt(dy2*dz2)) evaluated on the helices,
+    //which is never below the XY gap between the circles times (dz2/dy2)^(1/4)
+    if( !(NegRadius < 1e+10 && PosRadius < 1e+10) ) return kTRUE; //straight tracks: no bound
+    Double_t lGap = TMath::Max( lDist - NegRadius - PosRadius, TMath::Abs(NegRadius - PosRadius) - lDist );
+    if( lGap <= 0 ) return kTRUE;
+    Double_t dy2 = lNegCircle[3] + lPosCircle[3];
+    Double_t dz2 = lNegCircle[4] + lPosCircle[4];
+    if( !(dy2 > 0 && dz2 > 0) ) return kTRUE;
+    //Safety margin for rounding in the helix evaluation
+    Double_t lMargin = 1e-4 + 1e-6*(lDist + NegRadius + PosRadius);
+    return ( lGap*TMath::Sqrt(TMath::Sqrt(dz2/dy2)) <= fV0VertexerSels[3] + lMargin );
+}
+
 ///________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::SelectiveResetV0s(AliESDEvent *event, Int_t lType){
     //Selectively reset V0s
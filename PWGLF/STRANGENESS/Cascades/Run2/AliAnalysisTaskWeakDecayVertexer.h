@@ -300,6 +300,9 @@ public:
     //Improved DCA V0 Dau
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
+    //XY circle prefilter for V0 pairs, evaluated before any track copy
+    void GetHelixCircle(const AliExternalTrackParam *track,Double_t circle[5], Double_t b);
+    Bool_t IsV0PairXYCompatible(const Double_t lNegCircle[5], const Double_t lPosCircle[5]) const;
     //---------------------------------------------------------------------------------------
     
     //---------------------------------------------------------------------------------------
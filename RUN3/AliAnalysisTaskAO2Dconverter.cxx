@@ -21,6 +21,7 @@
 #include <TChain.h>
 #include <TTree.h>
 #include <TMath.h>
+#include <TROOT.h>
 #include "AliAnalysisTask.h"
 #include "AliAnalysisManager.h"
 #include "AliESDEvent.h"
@@ -79,6 +80,27 @@ ULong64_t GetEventIdAsLong(AliVHeader *header)
   return id;
 }
 
+UInt_t GetMantissaMask(UInt_t nbits)
+{
+  // Mask keeping the nbits most significant bits of the float mantissa
+  // (1 bit sign, 8 bits exponent, 23 bits mantissa)
+  if (nbits >= 23)
+    return 0xFFFFFFFF;
+  return 0xFFFFFFFF << (23 - nbits);
+}
+
+Float_t TruncateFloatFraction(Float_t x, UInt_t mask)
+{
+  // Mask the less significant bits in the float mantissa
+  union {
+    Float_t y;
+    UInt_t iy;
+  } myu;
+  myu.y = x;
+  myu.iy &= mask;
+  return myu.y;
+}
+
 } // namespace
 
 AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter(const char* name)
@@ -150,7 +172,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associate branches for fEventTree
   TTree* tEvents = CreateTree(kEvents);
-  tEvents->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kEvents]) {
     TString sstart = TString::Format("fStart[%d]/I", kTrees);
     TString sentries = TString::Format("fNentries[%d]/I", kTrees);
@@ -176,7 +197,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associate branches for fEventTree
   TTree* tBC = CreateTree(kBC);
-  tBC->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kBC]) {
     tBC->Branch("fRunNumber", &bc.fRunNumber, "fRunNumber/I");
     tBC->Branch("fGlobalBC", &bc.fGlobalBC, "fGlobalBC/l");
@@ -186,7 +206,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   
   // Associate branches for fTrackTree
   TTree* tTracks = CreateTree(kTracks);
-  tTracks->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kTracks]) {
     tTracks->Branch("fCollisionsID", &tracks.fCollisionsID, "fCollisionsID/I");
     tTracks->Branch("fTrackType", &tracks.fTrackType, "fTrackType/b");
@@ -235,7 +254,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associate branches for Calo
   TTree* tCalo = CreateTree(kCalo);
-  tCalo->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kCalo]) {
     tCalo->Branch("fBCsID", &calo.fBCsID, "fBCsID/I");
     tCalo->Branch("fCellNumber", &calo.fCellNumber, "fCellNumber/S");
@@ -247,7 +265,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   PostTree(kCalo);
 
   TTree *tCaloTrigger = CreateTree(kCaloTrigger);
-  tCaloTrigger->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kCaloTrigger]) {
     tCaloTrigger->Branch("fBCsID", &calotrigger.fBCsID, "fBCsID/I");
     tCaloTrigger->Branch("fFastOrAbsID", &calotrigger.fFastOrAbsID, "fFastOrAbsID/S");
@@ -261,7 +278,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associuate branches for MUON tracks
   TTree* tMuon = CreateTree(kMuon);
-  tMuon->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kMuon]) {
     tMuon->Branch("fBCsID", &muons.fBCsID, "fBCsID/I");
 //    tMuon->Branch("fClusterIndex", &muons.fClusterIndex, "fClusterIndex/I");
@@ -280,7 +296,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associate branches for MUON tracks
   TTree* tMuonCls = CreateTree(kMuonCls);
-  tMuonCls->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kMuonCls]) {
     tMuonCls->Branch("fMuonsID",&mucls.fMuonsID,"fMuonsID/I");
     tMuonCls->Branch("fX",&mucls.fX,"fX/F");
@@ -295,7 +310,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associuate branches for ZDC
   TTree* tZdc = CreateTree(kZdc);
-  tZdc->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kZdc]) {
     tZdc->Branch("fBCsID", &zdc.fBCsID, "fBCsID/I");
     tZdc->Branch("fZEM1Energy", &zdc.fZEM1Energy, "fZEM1Energy/F");
@@ -315,7 +329,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associuate branches for VZERO
   TTree* tVzero = CreateTree(kRun2V0);
-  tVzero->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kRun2V0]) {
     tVzero->Branch("fBCsID", &vzero.fBCsID, "fBCsID/I");
     tVzero->Branch("fAdc", vzero.fAdc, "fAdc[64]/F");
@@ -328,7 +341,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associuate branches for V0s
   TTree* tV0s = CreateTree(kV0s);
-  tV0s->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kV0s]) {
     tV0s->Branch("fPosTrackID", &v0s.fPosTrackID, "fPosTrackID/I");
     tV0s->Branch("fNegTrackID", &v0s.fNegTrackID, "fNegTrackID/I");
@@ -337,7 +349,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   // Associuate branches for cascades
   TTree* tCascades = CreateTree(kCascades);
-  tCascades->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kCascades]) {
     tCascades->Branch("fV0sID", &cascs.fV0sID, "fV0sID/I");
     tCascades->Branch("fTracksID", &cascs.fTracksID, "fTracksID/I");
@@ -347,7 +358,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 #ifdef USE_TOF_CLUST
   // Associate branches for TOF
   TTree* TOF = CreateTree(kTOF);
-  TOF->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kTOF]) {
     TOF->Branch("fTOFChannel", &tofClusters.fTOFChannel, "fTOFChannel/I");
     TOF->Branch("fTOFncls", &tofClusters.fTOFncls, "fTOFncls/S");
@@ -360,7 +370,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
   if (fTaskMode == kMC) {
     TTree * tMCvtx = CreateTree(kMCvtx);
-    tMCvtx->SetAutoFlush(fNumberOfEventsPerCluster);
     if(fTreeStatus[kMCvtx]) {
       tMCvtx->Branch("fGeneratorsID", &mcvtx.fGeneratorsID, "fGeneratorsID/S");
       tMCvtx->Branch("fX", &mcvtx.fX, "fX/F");
@@ -374,7 +383,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
     // Associate branches for Kinematics
     TTree* Kinematics = CreateTree(kKinematics);
-    Kinematics->SetAutoFlush(fNumberOfEventsPerCluster);
     if (fTreeStatus[kMC]) {
       Kinematics->Branch("fCollisionsID", &mcparticle.fCollisionsID, "fCollisionsID/I");
 
@@ -398,7 +406,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
 
     // Range for the MC labels of each reconstructed track
     TTree* tRange = CreateTree(kRange);
-    tRange->SetAutoFlush(fNumberOfEventsPerCluster);
     if (fTreeStatus[kRange]) {
       tRange->Branch("fRange", &range.fRange, "fRange/i");
       FillTree(kRange); // Put the begin of the first range to 0
@@ -407,7 +414,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
     
     // MC labels of each reconstructed track
     TTree* tLabels = CreateTree(kLabels);
-    tLabels->SetAutoFlush(fNumberOfEventsPerCluster);
     if (fTreeStatus[kLabels]) {
       tLabels->Branch("fLabel", &labels.fLabel, "fLabel/I");
     }
@@ -415,9 +421,37 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   }
 
 
+  ConfigureTrees(); // Cluster and basket settings of all the trees
   Prune(); //Removing all unwanted branches (if any)
 }
 
+void AliAnalysisTaskAO2Dconverter::ConfigureTrees()
+{
+  if (fUseImplicitMT) {
+#ifdef R__USE_IMT
+    // The baskets of the different branches are compressed in parallel when a cluster is flushed
+    if (!ROOT::IsImplicitMTEnabled())
+      ROOT::EnableImplicitMT(fNImplicitMTThreads);
+#else
+    AliWarning("ROOT was built without implicit multithreading, compressing serially");
+#endif
+  }
+
+  fMantissaMaskCov = fTruncate ? GetMantissaMask(fMantissaBitsCov) : 0xFFFFFFFF;
+  fMantissaMaskPID = fTruncate ? GetMantissaMask(fMantissaBitsPID) : 0xFFFFFFFF;
+
+  for (Int_t i = 0; i < kTrees; i++) {
+    if (!fTree[i])
+      continue;
+    fTree[i]->SetAutoFlush(fTreeAutoFlush[i] > 0 ? fTreeAutoFlush[i] : fNumberOfEventsPerCluster);
+    if (fTreeBasketSize[i] > 0)
+      fTree[i]->SetBasketSize("*", fTreeBasketSize[i]);
+#ifdef R__USE_IMT
+    fTree[i]->SetImplicitMT(fUseImplicitMT);
+#endif
+  }
+}
+
 void AliAnalysisTaskAO2Dconverter::Prune()
 {
   if (fPruneList.IsNull() || fPruneList.IsWhitespace())
@@ -511,6 +545,14 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
   vtx.fCovYY = covmatrix[3];
   vtx.fCovYZ = covmatrix[4];
   vtx.fCovZZ = covmatrix[5];
+  if (fTruncate) {
+    vtx.fCovXX = TruncateFloatFraction(vtx.fCovXX, fMantissaMaskCov);
+    vtx.fCovXY = TruncateFloatFraction(vtx.fCovXY, fMantissaMaskCov);
+    vtx.fCovXZ = TruncateFloatFraction(vtx.fCovXZ, fMantissaMaskCov);
+    vtx.fCovYY = TruncateFloatFraction(vtx.fCovYY, fMantissaMaskCov);
+    vtx.fCovYZ = TruncateFloatFraction(vtx.fCovYZ, fMantissaMaskCov);
+    vtx.fCovZZ = TruncateFloatFraction(vtx.fCovZZ, fMantissaMaskCov);
+  }
 
   vtx.fChi2 = pvtx->GetChi2();
   vtx.fN = (pvtx->GetNDF()+3)/2;
@@ -626,6 +668,29 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
     tracks.fTOFSignal = track->GetTOFsignal();
     tracks.fLength = track->GetIntegratedLength();
 
+    if (fTruncate) {
+      // Covariance matrix
+      tracks.fCYY = TruncateFloatFraction(tracks.fCYY, fMantissaMaskCov);
+      tracks.fCZY = TruncateFloatFraction(tracks.fCZY, fMantissaMaskCov);
+      tracks.fCZZ = TruncateFloatFraction(tracks.fCZZ, fMantissaMaskCov);
+      tracks.fCSnpY = TruncateFloatFraction(tracks.fCSnpY, fMantissaMaskCov);
+      tracks.fCSnpZ = TruncateFloatFraction(tracks.fCSnpZ, fMantissaMaskCov);
+      tracks.fCSnpSnp = TruncateFloatFraction(tracks.fCSnpSnp, fMantissaMaskCov);
+      tracks.fCTglY = TruncateFloatFraction(tracks.fCTglY, fMantissaMaskCov);
+      tracks.fCTglZ = TruncateFloatFraction(tracks.fCTglZ, fMantissaMaskCov);
+      tracks.fCTglSnp = TruncateFloatFraction(tracks.fCTglSnp, fMantissaMaskCov);
+      tracks.fCTglTgl = TruncateFloatFraction(tracks.fCTglTgl, fMantissaMaskCov);
+      tracks.fC1PtY = TruncateFloatFraction(tracks.fC1PtY, fMantissaMaskCov);
+      tracks.fC1PtZ = TruncateFloatFraction(tracks.fC1PtZ, fMantissaMaskCov);
+      tracks.fC1PtSnp = TruncateFloatFraction(tracks.fC1PtSnp, fMantissaMaskCov);
+      tracks.fC1PtTgl = TruncateFloatFraction(tracks.fC1PtTgl, fMantissaMaskCov);
+      tracks.fC1Pt21Pt2 = TruncateFloatFraction(tracks.fC1Pt21Pt2, fMantissaMaskCov);
+      // PID signals
+      tracks.fTPCSignal = TruncateFloatFraction(tracks.fTPCSignal, fMantissaMaskPID);
+      tracks.fTRDSignal = TruncateFloatFraction(tracks.fTRDSignal, fMantissaMaskPID);
+      tracks.fTOFSignal = TruncateFloatFraction(tracks.fTOFSignal, fMantissaMaskPID);
+    }
+
     if (fTaskMode == kMC) {
       // Separate tables (trees) for the MC labels
       // Right now we have only one label, the data model is adapted to many labels
@@ -769,7 +834,7 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
     mutrk->GetCovariances(cov);
     for (Int_t i = 0; i < 5; i++)
       for (Int_t j = 0; j <= i; j++)
-	muons.fCovariances[i*(i+1)/2 + j] = cov(i,j);
+	muons.fCovariances[i*(i+1)/2 + j] = fTruncate ? TruncateFloatFraction(cov(i,j), fMantissaMaskCov) : cov(i,j);
 
     muons.fChi2 = mutrk->GetChi2();
     muons.fChi2MatchTrigger = mutrk->GetChi2MatchTrigger();
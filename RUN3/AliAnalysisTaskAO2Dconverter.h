@@ -35,6 +35,10 @@ public:
   virtual void Terminate(Option_t *option);
 
   void SetNumberOfEventsPerCluster(int n) { fNumberOfEventsPerCluster = n; }
+  void SetTruncation(Bool_t trunc=kTRUE) { fTruncate = trunc; }
+  void SetMantissaBitsCov(UInt_t nbits) { fMantissaBitsCov = nbits; } // Mantissa bits kept for the covariance matrices (0-23)
+  void SetMantissaBitsPID(UInt_t nbits) { fMantissaBitsPID = nbits; } // Mantissa bits kept for the PID signals (0-23)
+  void SetImplicitMT(Int_t nThreads=0) { fUseImplicitMT = kTRUE; fNImplicitMTThreads = nThreads; } // Parallel basket compression, 0 = ROOT default number of threads
 
   static AliAnalysisTaskAO2Dconverter* AddTask(TString suffix = "");
   enum TreeIndex { // Index of the output trees
@@ -87,6 +91,8 @@ public:
   void PostTree(TreeIndex t);
   void EnableTree(TreeIndex t) { fTreeStatus[t] = kTRUE; };
   void DisableTree(TreeIndex t) { fTreeStatus[t] = kFALSE; };
+  void SetNumberOfEntriesPerCluster(TreeIndex t, int n) { fTreeAutoFlush[t] = n; }; // Overrides fNumberOfEventsPerCluster for one tree
+  void SetBasketSize(TreeIndex t, int size) { fTreeBasketSize[t] = size; };         // Basket size (bytes) of all the branches of one tree
   static const TString TreeName[kTrees];  //! Names of the TTree containers
   static const TString TreeTitle[kTrees]; //! Titles of the TTree containers
 
@@ -106,11 +112,24 @@ private:
   TTree* fTree[kTrees] = { nullptr }; //! Array with all the output trees
   void Prune();                       // Function to perform tree pruning
   void FillTree(TreeIndex t);         // Function to fill the trees (only the active ones)
+  void ConfigureTrees();              // Function to apply the cluster and basket settings
 
   // Task configuration variables
   TString fPruneList = "";                // Names of the branches that will not be saved to output file
   Bool_t fTreeStatus[kTrees] = { kTRUE }; // Status of the trees i.e. kTRUE (enabled) or kFALSE (disabled)
   int fNumberOfEventsPerCluster = 1000;   // Maximum basket size of the trees
+  int fTreeAutoFlush[kTrees] = { 0 };     // Per-tree auto flush setting, 0 = use fNumberOfEventsPerCluster
+  int fTreeBasketSize[kTrees] = { 0 };    // Per-tree basket size, 0 = ROOT default
+
+  // Lossy compression: truncation of the float mantissa of selected columns
+  Bool_t fTruncate = kFALSE;              // Switch on/off the truncation
+  UInt_t fMantissaBitsCov = 23;           // Number of mantissa bits kept for the covariance matrices
+  UInt_t fMantissaBitsPID = 23;           // Number of mantissa bits kept for the PID signals
+  UInt_t fMantissaMaskCov = 0xFFFFFFFF;   //! Bit mask derived from fMantissaBitsCov
+  UInt_t fMantissaMaskPID = 0xFFFFFFFF;   //! Bit mask derived from fMantissaBitsPID
+
+  Bool_t fUseImplicitMT = kFALSE;         // Compress the baskets of the trees in parallel using ROOT implicit multithreading
+  Int_t fNImplicitMTThreads = 0;          // Number of threads for implicit multithreading (0 = ROOT default)
 
   TaskModes fTaskMode = kStandard; // Running mode of the task. Useful to set for e.g. MC mode
 
@@ -404,7 +423,7 @@ private:
   Int_t fOffsetV0ID = 0;      ///! Offset of track IDs (used in cascades)
   Int_t fOffsetLabel = 0;      ///! Offset of track IDs (used in cascades)
 
-  ClassDef(AliAnalysisTaskAO2Dconverter, 7);
+  ClassDef(AliAnalysisTaskAO2Dconverter, 8);
 };
 
 #endif